@@ -0,0 +1,180 @@
+/*
+  AdcSampler - free running, oversampled ADC for the implement sensors
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AdcSampler.h"
+
+#ifdef ADC_SAMPLER
+#include <avr/interrupt.h>
+
+// Channels in conversion order
+static const byte adc_mux[ADC_CHANNELS] = {ADC_POSITION, ADC_ROTATION};
+
+AdcSampler adc_sampler;
+
+// -----------
+// Constructor
+// -----------
+AdcSampler::AdcSampler(){
+  channel = 0;
+  skip = 0;
+
+  sum = 0;
+  count = 0;
+
+  for (byte i = 0; i < ADC_CHANNELS; i++){
+    primed[i] = false;
+    for (byte j = 0; j < 3; j++){
+      history[i][j] = 0;
+    }
+    next[i] = 0;
+    filter[i] = 0;
+    value[i][0] = 0;
+    value[i][1] = 0;
+    front[i] = 0;
+    updates[i] = 0;
+  }
+}
+
+// -----------------------------------------------------------------
+// Method for starting free running conversions, AVcc reference and
+// 125 kHz ADC clock (16 MHz / 128), about 9600 conversions a second
+// -----------------------------------------------------------------
+void AdcSampler::begin(){
+  uint8_t _sreg = SREG;
+
+  cli();
+
+  // Digital inputs off on the sensor pins
+  for (byte i = 0; i < ADC_CHANNELS; i++){
+    DIDR0 |= 1 << adc_mux[i];
+  }
+
+  channel = 0;
+  skip = 1;
+  ADMUX = (1 << REFS0) | adc_mux[0];
+  ADCSRB = 0;
+  ADCSRA = (1 << ADEN) | (1 << ADSC) | (1 << ADATE) | (1 << ADIE) |
+           (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+
+  SREG = _sreg;
+}
+
+// ---------------------------------------------------------------------
+// Method for handling a conversion (interrupt). The next conversion has
+// already started when this runs, so a new channel selected here only
+// applies to the one after it; that one in between is skipped.
+// ---------------------------------------------------------------------
+void AdcSampler::convert(unsigned int _result){
+  unsigned int _value;
+
+  if (skip){
+    skip--;
+    return;
+  }
+
+  sum += _result;
+  if (++count < ADC_OVERSAMPLE){
+    return;
+  }
+
+  // Decimate, then median of three against single spikes
+  _value = sum / (ADC_OVERSAMPLE >> ADC_DECIMATE);
+  sum = 0;
+  count = 0;
+
+  // First value of a channel fills the history and the filter
+  if (!primed[channel]){
+    for (byte i = 0; i < 3; i++){
+      history[channel][i] = _value;
+    }
+    filter[channel] = _value << ADC_IIR;
+    primed[channel] = true;
+  }
+
+  history[channel][next[channel]] = _value;
+  if (++next[channel] == 3){
+    next[channel] = 0;
+  }
+  _value = median(channel);
+
+  // IIR, filter holds the value scaled by 2^ADC_IIR
+  filter[channel] += _value - (filter[channel] >> ADC_IIR);
+  publish(channel, filter[channel] >> ADC_IIR);
+
+  // Next channel
+  if (++channel == ADC_CHANNELS){
+    channel = 0;
+  }
+  ADMUX = (1 << REFS0) | adc_mux[channel];
+  skip = 1;
+}
+
+// ---------------------------------------
+// Method for the median of the last three
+// ---------------------------------------
+unsigned int AdcSampler::median(byte _channel){
+  unsigned int _a = history[_channel][0];
+  unsigned int _b = history[_channel][1];
+  unsigned int _c = history[_channel][2];
+
+  if (_a > _b){
+    unsigned int _t = _a;
+    _a = _b;
+    _b = _t;
+  }
+  if (_b > _c){
+    _b = _c;
+  }
+  return _a > _b ? _a : _b;
+}
+
+// -----------------------------------------------------------------
+// Method for publishing a value, written to the slot readers do not
+// use, then made the front with a single byte store
+// -----------------------------------------------------------------
+void AdcSampler::publish(byte _channel, unsigned int _value){
+  byte _back = front[_channel] ^ 1;
+
+  value[_channel][_back] = _value;
+  front[_channel] = _back;
+  updates[_channel]++;
+}
+
+// -------------------------------------------------------
+// Method for the number of values published, wraps around
+// -------------------------------------------------------
+unsigned int AdcSampler::getUpdates(byte _channel){
+  unsigned int _updates;
+  uint8_t _sreg = SREG;
+
+  cli();
+  _updates = updates[_channel];
+  SREG = _sreg;
+
+  return _updates;
+}
+
+// ---------------
+// Conversion done
+// ---------------
+ISR(ADC_vect){
+  adc_sampler.convert(ADC);
+}
+
+#endif
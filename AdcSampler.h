@@ -0,0 +1,81 @@
+/*
+  AdcSampler - free running, oversampled ADC for the implement sensors
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AdcSampler_h
+#define AdcSampler_h
+
+#include "Arduino.h"
+#include "ConfigInterfacePlough.h"
+
+#define ADC_CHANNELS      2
+#define ADC_BITS          (10 + ADC_DECIMATE)
+
+// Converts the sensor channels round robin in ADC free running mode. The
+// interrupt sums ADC_OVERSAMPLE conversions per channel, decimates the sum
+// to ADC_BITS, takes the median of the last three values and smooths that
+// with an IIR filter. The result is published in one of two slots per
+// channel, so read() never waits and never sees a value being written.
+//
+// While running, analogRead() must not be used: it stops free running mode.
+class AdcSampler {
+private:
+  //-------------
+  // data members
+  //-------------
+  // Channel of the conversion that completes next, conversions to skip
+  byte channel;
+  byte skip;
+
+  // Oversampling
+  unsigned int sum;
+  byte count;
+
+  // Median and IIR, per channel, primed by the first value
+  boolean primed[ADC_CHANNELS];
+  unsigned int history[ADC_CHANNELS][3];
+  byte next[ADC_CHANNELS];
+  unsigned int filter[ADC_CHANNELS];
+
+  // Published values, double buffered
+  unsigned int value[ADC_CHANNELS][2];
+  volatile byte front[ADC_CHANNELS];
+  volatile unsigned int updates[ADC_CHANNELS];
+
+  //-----------------------------------
+  // private member functions
+  //-----------------------------------
+  unsigned int median(byte _channel);
+  void publish(byte _channel, unsigned int _value);
+public:
+  // Constructor
+  AdcSampler();
+
+  void begin();
+  void convert(unsigned int _result);
+
+  // Getters
+  inline unsigned int read(byte _channel){
+    return value[_channel][front[_channel]];
+  };
+  unsigned int getUpdates(byte _channel);
+};
+
+extern AdcSampler adc_sampler;
+
+#endif
@@ -24,6 +24,117 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //#define VOORSERIE
 //#define DEBUG
 
+// XTE estimator: steady-state Kalman gains (Q8) for a constant rate model,
+// tracking index 0.5 (2 cm fix noise at 10 Hz), interpolated between fixes.
+// Off, the implement gets the XTE of the last fix. Needs an implement
+// library with update(mode, buttons, xte), as the SIM stand-in.
+//#define XTE_ESTIMATOR
+#define KF_ALPHA          161
+#define KF_BETA           78
+#define KF_RESET          1000  // ms without fix before the estimate restarts
+#define KF_INTERVAL_MIN   50UL  // ms shortest fix interval (20 Hz)
+#define KF_RESIDUAL_MAX   100   // cm largest correction per fix
+#define KF_RATE_MAX       100   // cm/s largest XTE rate
+
+// Feed-forward XTE prediction over fix age plus system latency, on the rate
+// of XTE_ESTIMATOR
+//#define PREDICT
+#define PREDICT_LATENCY   150   // ms from fix to plough movement
+#define PREDICT_MAX       500   // ms maximum prediction horizon
+
+// Rate and acceleration limits on the AUTO setpoint, same implement as
+// XTE_ESTIMATOR
+//#define SHAPE
+#define SHAPE_RATE        20    // cm/s
+#define SHAPE_ACCEL       200   // cm/s2
+
+// Run against the simulated plough/tractor in SimPlough.h instead of
+// ImplementPlough, VehicleTractor and VehicleGps
+//#define SIM
+
+// Read NMEA from a serial port with the bounded reader in NmeaStream.h
+// instead of VehicleGps
+//#define NMEA_STREAM
+
+// Implements driven by one interface, the screen pages between them. With
+// more than 1, addImplement() adds a front or rear plough or a section.
+#define IMPLEMENTS        1
+#define IMPLEMENT_PAGE    3000  // ms each implement is shown
+
+// Loop monitor: a tick over LOOP_BUDGET, or LOOP_MISSES ticks in a row over
+// LOOP_DEADLINE, stops the implement and holds for LOOP_HOLD
+#define LOOP_BUDGET       250   // ms
+#define LOOP_DEADLINE     50    // ms
+#define LOOP_MISSES       5
+#define LOOP_HOLD         2000  // ms
+
+// Hardware watchdog backing up the loop monitor (AVR only)
+//#define WATCHDOG
+#define WATCHDOG_TIMEOUT  WDTO_500MS
+
+// Ticks in HOLD and MANUAL, in between only GPS input, buttons, mode switch,
+// the screen and the valves (adjust()) are serviced
+#define RATE_HOLD         100   // ms
+#define RATE_MANUAL       100   // ms
+
+// Sleep (AVR idle mode) between ticks in HOLD and MANUAL
+//#define IDLE_SLEEP
+
+// Position and rotation sensors converted in the background by AdcSampler,
+// read with adc_sampler.read() (ADC_BITS) instead of analogRead(). The
+// implement library has to read its sensors that way and define
+// IMPLEMENT_ADC_SAMPLER.
+//#define ADC_SAMPLER
+#define ADC_POSITION      0     // ADC channel of the position sensor
+#define ADC_ROTATION      1     // ADC channel of the rotation sensor
+#define ADC_OVERSAMPLE    16    // conversions per value (4^n for n bits)
+#define ADC_DECIMATE      2     // extra bits kept of the sum
+#define ADC_IIR           2     // new value weighs 1/2^n
+
+// Wheel speed from Timer1 input capture on pin 8 (ICP1) decides the minimum
+// speed for AUTO instead of GPS. Timer1 is then no longer available for PWM
+// on pins 9 and 10. The speed step of calibrate() counts the pulses over a
+// measured 100 m.
+//#define WHEEL_SPEED
+#define WHEEL_PULSES      1000  // pulses per 100 m, until calibrated
+#define WHEEL_EEPROM      1022  // EEPROM address of the calibrated pulses
+#define WHEEL_WINDOW      8     // periods averaged
+#define WHEEL_TIMEOUT     2000  // ms without a pulse is standstill
+#define WHEEL_MIN_SPEED   20    // 0.1 km/h
+
+#ifdef SIM
+#undef WATCHDOG
+#undef IDLE_SLEEP
+#undef ADC_SAMPLER
+#undef WHEEL_SPEED
+#endif
+
+// Fix to valve latency histogram, reported over Serial and in calibrate
+//#define LATENCY
+#define LATENCY_BIN       10    // ms per histogram bin, 1 - 999
+#define LATENCY_BINS      8     // last bin collects everything above
+#define LATENCY_REPORT    100   // fixes between Serial reports
+
+// Execution time of update() and its parts, reported over Serial in CPU
+// cycles (4 us, 64 cycles resolution at 16 MHz). extras/simavr counts exact
+// cycles of the SIM build.
+//#define PROFILE
+#define PROFILE_REPORT    5000  // ms between Serial reports
+
+// Screen texts packed in flash by extras/strings/packstrings.py, run it
+// after changing language.h
+//#define PACKED_STRINGS
+
+// Autotune
+#define TUNE_STEP         10    // cm width step per direction
+#define TUNE_TIMEOUT      8000  // ms maximum duration of a step
+#define TUNE_PROBE        1000  // ms per PWM level while probing deadband
+#define TUNE_PWM_MIN      30    // PWM to start probing deadband
+#define TUNE_PWM_STEP     10    // PWM increment while probing deadband
+#define TUNE_SETTLE       500   // ms to wait for the plough to coast out
+#define TUNE_COAST        2     // cm allowed to coast during lag in AUTO
+#define TUNE_COR_SHARE    6     // cm max. correction per share
+
 #ifndef VOORSERIE
 // Defines for io ports
 // Digital debounced inputs
@@ -31,7 +142,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define LEFT_BUTTON       5
 #define RIGHT_BUTTON      6
 //#define xxx             7
-//#define xxx             8
+//#define xxx             8     // ICP1 with WHEEL_SPEED
 //#define xxx             13
 
 #else
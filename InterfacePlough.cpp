@@ -19,13 +19,22 @@
 
 #include "InterfacePlough.h"
 
+#ifdef WATCHDOG
+#include <avr/wdt.h>
+#endif
+
+#ifdef IDLE_SLEEP
+#include <avr/sleep.h>
+#endif
+
 // -----------
 // Constructor
 // -----------
-InterfacePlough::InterfacePlough(LiquidCrystal_I2C * _lcd,
-                     ImplementPlough * _implement,
-                     VehicleTractor * _tractor,
-                     VehicleGps * _gps){
+template <class Features>
+InterfacePlough<Features>::InterfacePlough(LiquidCrystal_I2C * _lcd,
+                               ImplementPlough * _implement,
+                               VehicleTractor * _tractor,
+                               VehicleGps * _gps){
   // Pin assignments and configuration
   // Schmitt triggered inputs
   pinMode(LEFT_BUTTON, INPUT);
@@ -35,34 +44,145 @@ InterfacePlough::InterfacePlough(LiquidCrystal_I2C * _lcd,
   digitalWrite(LEFT_BUTTON, LOW);
   digitalWrite(RIGHT_BUTTON, LOW);
   digitalWrite(MODE_PIN, LOW);
+
+#ifdef ADC_SAMPLER
+  // Sensors converted in the background from here on
+  adc_sampler.begin();
+#endif
+
+#ifdef WHEEL_SPEED
+  // Wheel pulses timed by Timer1 from here on
+  wheel_speed.begin();
+#endif
   
   // Mode
   mode = 2;  // MANUAL
   
   // Button flag
   buttons = 0;
+  button_pending = 0;
+  button_chord = false;
+  button_repeat = false;
   button1_flag = false;
   button2_flag = false;
+  button1_timer = millis();
+  button2_timer = button1_timer;
+
+  // Sensor snapshot, first filled by update()
+  memset(&snapshot, 0, sizeof(snapshot));
+
+  // XTE estimator
+  xte_estimate = 0;
+  xte_rate = 0;
+  xte_step = 0;
+  xte_fix = 0;
+  xte_interval = 100;
+  xte_recip = 655;
+
+  // Command shaping
+  shape_position = 0;
+  shape_rate = 0;
+  shape_carry = 0;
+  shape_time = 0;
+
+  tick_time = 0;
+
+#ifdef PROFILE
+  // Execution times
+  memset(profile, 0, sizeof(profile));
+  profile_time = 0;
+#endif
+
+  // Loop monitor
+  loop_time = 0;
+  loop_period = 0;
+  overrun_time = 0;
+  loop_misses = 0;
+  loop_started = false;
+  overrun = false;
+
+#ifdef LATENCY
+  // Latency
+  for (byte i = 0; i < LATENCY_BINS; i++){
+    latency_bins[i] = 0;
+  }
+  latency_min = 0xFFFF;
+  latency_max = 0;
+  latency_sum = 0;
+  latency_count = 0;
+#endif
 
   // Connected classes
   lcd = _lcd;
   implement = _implement;
   tractor = _tractor;
   gps = _gps;
+
+  // Implements
+  implements[0] = _implement;
+  implement_count = 1;
+  implement_page = 0;
+  implement_next = 0;
+  page_timer = millis();
+}
+
+// -------------------------------------
+// Method for adding a further implement
+// -------------------------------------
+template <class Features>
+boolean InterfacePlough<Features>::addImplement(ImplementPlough * _implement){
+  if (implement_count >= Features::implements){
+    return false;
+  }
+  implements[implement_count++] = _implement;
+  return true;
 }
 
 // ------------------------
 // Method for updating mode
 // ------------------------
-void InterfacePlough::update(){
-  // Check buttons
-  checkButtons(255, 0);
-  
+template <class Features>
+void InterfacePlough<Features>::update(){
+  boolean _fix = false;
+#ifdef PROFILE
+  unsigned long _start = PROFILE_CLOCK();
+  unsigned long _part;
+#endif
+
+  // Check time since last tick
+  checkLoop();
+
   // update GPS and tractor
   gps->update();
   tractor->update();
-  
-  // Check for mode change
+
+  // Between ticks in HOLD and MANUAL
+  if (idle()){
+    return;
+  }
+  tick_time = millis();
+
+  // Select shown implement
+  checkPage();
+
+  // Read sensors once for this tick
+  takeSnapshot();
+
+  // A new fix in automatic is acted upon before buttons and screen, so the
+  // delay from fix to valve does not depend on the rest of the loop
+  if (mode == 0 && snapshot.xte_fix != xte_fix){
+    control(snapshot, 0);
+    _fix = true;
+  }
+
+  // Check buttons
+#ifdef PROFILE
+  _part = PROFILE_CLOCK();
+#endif
+  checkButtons(255, 0);
+#ifdef PROFILE
+  recordProfile(PROFILE_BUTTONS, _part);
+#endif
 
   // ---------
   // Calibrate
@@ -70,40 +190,251 @@ void InterfacePlough::update(){
   if(buttons == 2){
     mode = 3;
 
-#ifdef DEBUG
-    Serial.println("C");
-#endif 
+    if (Features::debug){
+      Serial.println("C");
+    }
 
     // Calibrate
     calibrate();
+
+    // Calibration is not a loop overrun
+    loop_time = millis();
+  }
+  else if (!_fix){
+    control(snapshot, buttons);
+  }
+  else if (buttons){
+    implement->adjust(buttons);
   }
+
+  // Update screen (no rewrite) and write one character
+#ifdef PROFILE
+  _part = PROFILE_CLOCK();
+#endif
+  updateScreen(0); 
+#ifdef PROFILE
+  recordProfile(PROFILE_SCREEN, _part);
+  _part = PROFILE_CLOCK();
+#endif
+  lcd->write_screen(1);  
+
+#ifdef PROFILE
+  recordProfile(PROFILE_LCD, _part);
+
+  // A tick with calibration would only measure the operator
+  if (mode != 3){
+    recordProfile(PROFILE_UPDATE, _start);
+  }
+  if (millis() - profile_time > PROFILE_REPORT){
+    profile_time = millis();
+    reportProfile();
+  }
+#endif
+}
+
+// -----------------------------------------------
+// Method for checking loop deadlines and watchdog
+// -----------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::checkLoop(){
+  unsigned long _now = millis();
+  unsigned long _period = _now - loop_time;
+
+  loop_time = _now;
+  loop_period = _period;
+
+  // Watchdog starts with the loop, not during setup
+  if (!loop_started){
+    loop_started = true;
+#ifdef WATCHDOG
+    wdt_enable(WATCHDOG_TIMEOUT);
+#endif
+    return;
+  }
+
+#ifdef WATCHDOG
+  wdt_reset();
+#endif
+
+  if (_period > LOOP_DEADLINE){
+    if (loop_misses < 255){
+      loop_misses++;
+    }
+  }
+  else {
+    loop_misses = 0;
+  }
+
+  // The last command may have driven the cylinder for the whole overrun
+  if (_period > LOOP_BUDGET ||
+      loop_misses >= LOOP_MISSES){
+    stopImplements();
+    overrun = true;
+    overrun_time = _now;
+    loop_misses = 0;
+
+    if (Features::debug){
+      Serial.print("O");
+      Serial.println(_period);
+    }
+  }
+  else if (overrun && _now - overrun_time > LOOP_HOLD){
+    overrun = false;
+  }
+}
+
+// ----------------------------------------------
+// Method for paging between implements on screen
+// ----------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::checkPage(){
+  // A single implement is always shown
+  if (Features::implements < 2){
+    return;
+  }
+
+  // Buttons keep the implement they adjust on screen
+  if (buttons != 0 || implement_count < 2){
+    page_timer = millis();
+    return;
+  }
+
+  if (millis() - page_timer > IMPLEMENT_PAGE){
+    page_timer = millis();
+
+    if (++implement_page >= implement_count){
+      implement_page = 0;
+    }
+    implement = implements[implement_page];
+  }
+}
+
+// ----------------------------------
+// Method for stopping all implements
+// ----------------------------------
+template <class Features>
+void InterfacePlough<Features>::stopImplements(){
+  for (byte i = 0; i < implement_count; i++){
+    implements[i]->stop();
+  }
+}
+
+// ------------------------------------------
+// Method for reading all sensors of one tick
+// ------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::takeSnapshot(){
+  snapshot.time = millis();
+
+  snapshot.offset = implement->getOffset();
+  snapshot.position = implement->getPosition();
+#ifdef ROTATION
+  snapshot.rotation = implement->getRotation();
+#endif
+  snapshot.side = implement->getSide();
+
+  snapshot.hitch = tractor->getHitch();
+  snapshot.manual = !digitalRead(MODE_PIN);
+
+  snapshot.xte = gps->getXte();
+  snapshot.quality = gps->getQuality();
+#ifdef WHEEL_SPEED
+  snapshot.min_speed = wheel_speed.minSpeed();
+#else
+  snapshot.min_speed = gps->minSpeed();
+#endif
+  snapshot.gga_fix = gps->getGgaFixAge();
+  snapshot.vtg_fix = gps->getVtgFixAge();
+  snapshot.xte_fix = gps->getXteFixAge();
+}
+
+// --------------------------------------------
+// Method for skipping ticks in HOLD and MANUAL
+// --------------------------------------------
+template <class Features>
+boolean InterfacePlough<Features>::idle(){
+  unsigned int _rate;
+
+  if (mode == 1){
+    _rate = RATE_HOLD;
+  }
+  else if (mode == 2){
+    _rate = RATE_MANUAL;
+  }
+  else {
+    return false;
+  }
+
+  // Wake on buttons, the mode switch, the hitch or, in HOLD, a new fix. The
+  // pins are polled, every interrupt (at least the millis() timer) ends the
+  // sleep.
+  if (millis() - tick_time >= _rate ||
+      buttons != 0 ||
+      button_pending != 0 ||
+      digitalRead(LEFT_BUTTON) ||
+      digitalRead(RIGHT_BUTTON) ||
+      !digitalRead(MODE_PIN) != snapshot.manual ||
+      tractor->getHitch() != snapshot.hitch ||
+      (mode == 1 && gps->getXteFixAge() != snapshot.xte_fix)){
+    return false;
+  }
+
+  // Keep writing the screen and timing the valves
+  lcd->write_screen(1);
+  for (byte i = 0; i < implement_count; i++){
+    implements[i]->adjust(0);
+  }
+
+#ifdef IDLE_SLEEP
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_mode();
+#endif
+
+  return true;
+}
+
+// ---------------------------------------------
+// Method for mode decision and implement update
+// ---------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::control(const PloughSnapshot & _snapshot,
+                                        int _buttons){
+  // Fix that has not been acted upon yet
+  boolean _fix = _snapshot.xte_fix != xte_fix;
+#ifdef INTERFACE_XTE
+  int _xte;
+#endif
+#ifdef PROFILE
+  unsigned long _start = PROFILE_CLOCK();
+#endif
+
   // ------
   // Manual
   // ------
-  else if(!digitalRead(MODE_PIN) ||
-          tractor->getHitch()){
+  if(_snapshot.manual ||
+     _snapshot.hitch){
     // set mode to manual
     mode = 2;
 
-#ifdef DEBUG
-    Serial.println("M");
-#endif
+    if (Features::debug){
+      Serial.println("M");
+    }
   }
   else {
     // ----
     // Hold
     // ----
-    if (millis() - gps->getGgaFixAge() > 2000 ||
-        millis() - gps->getVtgFixAge() > 2000 ||
-        millis() - gps->getXteFixAge() > 2000 ||
-        gps->getQuality() != 4 ||
-        !gps->minSpeed()){
+    if (_snapshot.time - _snapshot.gga_fix > 2000 ||
+        _snapshot.time - _snapshot.vtg_fix > 2000 ||
+        _snapshot.time - _snapshot.xte_fix > 2000 ||
+        _snapshot.quality != 4 ||
+        !_snapshot.min_speed){
       // set mode to hold
       mode = 1;
       
-#ifdef DEBUG
-      Serial.println("H");
-#endif
+      if (Features::debug){
+        Serial.println("H");
+      }
     }
     // ---------
     // Automatic
@@ -112,49 +443,138 @@ void InterfacePlough::update(){
       // set mode to automatic
       mode = 0;
 
-#ifdef DEBUG
-      Serial.println("A");
-#endif
+      if (Features::debug){
+        Serial.println("A");
+      }
     }
   }
   
-  // Update implement and adjust
-  implement->update(mode, buttons);
-  implement->adjust(buttons);
-  
-  // Update screen (no rewrite) and write one character
-  updateScreen(0); 
-  lcd->write_screen(1);  
+  // ------------------
+  // Hold after overrun
+  // ------------------
+  if (overrun){
+    mode = 1;
+
+    if (Features::debug){
+      Serial.println("O");
+    }
+  }
+
+  // Update implements with estimated XTE, all of them on a new fix and
+  // otherwise one per tick. Every valve is timed by adjust() on every tick.
+  // Buttons go to the shown implement.
+#ifdef INTERFACE_XTE
+  if (Features::estimator){
+    estimateXte(_snapshot);
+    _xte = shapeXte(predictXte());
+  }
+  else {
+    xte_fix = _snapshot.xte_fix;
+    _xte = shapeXte(_snapshot.xte);
+  }
+#else
+  // The implement reads the XTE of the last fix itself
+  xte_fix = _snapshot.xte_fix;
+#endif
+
+  for (byte i = 0; i < implement_count; i++){
+    if (_fix || i == implement_next){
+#ifdef INTERFACE_XTE
+      implements[i]->update(mode, i == implement_page ? _buttons : 0, _xte);
+#else
+      implements[i]->update(mode, i == implement_page ? _buttons : 0);
+#endif
+    }
+    implements[i]->adjust(i == implement_page ? _buttons : 0);
+  }
+
+  if (Features::implements > 1 && ++implement_next >= implement_count){
+    implement_next = 0;
+  }
+
+#ifdef LATENCY
+  // Time from arrival of the fix until its command reached the valve
+  if (_fix && mode == 0){
+    recordLatency(millis() - xte_fix);
+  }
+#endif
+
+#ifdef PROFILE
+  recordProfile(PROFILE_CONTROL, _start);
+#endif
+}
+
+// ------------------------------------------------
+// Method for writing a text of language.h on a row
+// ------------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::writeText(const char * _text, int _row){
+#ifdef PACKED_STRINGS
+  // Decode from flash straight into the screen buffer, see LanguagePacked.h
+  byte _column = 0;
+  byte _c;
+  unsigned int _entry;
+  unsigned int _end;
+
+  while (_column < LANG_COLUMNS){
+    _c = pgm_read_byte(_text++);
+
+    if (_c >= LANG_DICT){
+      _entry = pgm_read_word(&lang_dict_index[_c - LANG_DICT]);
+      _end = pgm_read_word(&lang_dict_index[_c - LANG_DICT + 1]);
+      while (_entry < _end){
+        lcd->write_buffer(char(pgm_read_byte(&lang_dict[_entry++])),
+                          _row, _column++);
+      }
+    }
+    else if (_c == LANG_ESCAPE){
+      lcd->write_buffer(char(pgm_read_byte(_text++)), _row, _column++);
+    }
+    else if (_c <= LANG_RUN_MAX){
+      while (_c--){
+        lcd->write_buffer(' ', _row, _column++);
+      }
+    }
+    else {
+      lcd->write_buffer(char(_c), _row, _column++);
+    }
+  }
+#else
+  lcd->write_buffer(_text, _row);
+#endif
 }
 
 // --------------------------
 // Method for updating screen
 // --------------------------
-void InterfacePlough::updateScreen(boolean _rewrite){
+template <class Features>
+void InterfacePlough<Features>::updateScreen(boolean _rewrite){
+  // Show what the controller acted on this tick
+  const PloughSnapshot & _snapshot = snapshot;
   int temp = 0;
   int temp2 = 0;
 
   // Update screen
   if (_rewrite){
     // Regel 0
-    lcd->write_buffer(L_POS, 0);
+    writeText(L_POS, 0);
 
     // Regel 1
-    lcd->write_buffer(L_A_POS, 1);
+    writeText(L_A_POS, 1);
 
     // Regel 2
-    lcd->write_buffer(L_XTE, 2);
+    writeText(L_XTE, 2);
 
-#ifdef ROTATION
-    // Regel 3
-    lcd->write_buffer(L_ROTATION, 3);
-#endif
+    if (Features::rotation){
+      // Regel 3
+      writeText(L_ROTATION, 3);
+    }
 
     lcd->write_screen(-1);
   }
 
   // Regel 0
-  temp2 = implement->getOffset();
+  temp2 = _snapshot.offset;
   temp = abs(temp2);
 
   if (temp > 99){
@@ -195,7 +615,7 @@ void InterfacePlough::updateScreen(boolean _rewrite){
   }
 
   // Regel 1
-  temp2 = implement->getPosition();
+  temp2 = _snapshot.position;
   temp = abs(temp2);
 
   if (temp > 99){
@@ -237,7 +657,7 @@ void InterfacePlough::updateScreen(boolean _rewrite){
 
 
   // Regel 2
-  temp2 = gps->getXte();
+  temp2 = _snapshot.xte;
   temp = abs(temp2);
 
   if (temp > 99){
@@ -277,55 +697,60 @@ void InterfacePlough::updateScreen(boolean _rewrite){
     lcd->write_buffer(temp + '0', 2, 19);
   }
 
-#ifdef ROTATION
-  // Regel  3
-  temp2 = implement->getRotation();
-  temp = abs(temp2);
+  if (Features::rotation){
+    // Regel  3
+    temp2 = _snapshot.rotation;
+    temp = abs(temp2);
 
-  if (temp > 99){
-    if (temp2 < 0){
-      lcd->write_buffer('-', 3, 9);
+    if (temp > 99){
+      if (temp2 < 0){
+        lcd->write_buffer('-', 3, 9);
+      }
+      else {
+        lcd->write_buffer(' ', 3, 9);
+      }
+      lcd->write_buffer(temp / 100 + '0', 3, 10);
+      temp = temp % 100;
+      lcd->write_buffer(temp / 10 + '0', 3, 11);
+      temp = temp % 10;
+      lcd->write_buffer(temp + '0', 3, 12);
     }
-    else {
+    else if (temp > 9){
       lcd->write_buffer(' ', 3, 9);
-    }
-    lcd->write_buffer(temp / 100 + '0', 3, 10);
-    temp = temp % 100;
-    lcd->write_buffer(temp / 10 + '0', 3, 11);
-    temp = temp % 10;
-    lcd->write_buffer(temp + '0', 3, 12);
-  }
-  else if (temp > 9){
-    lcd->write_buffer(' ', 3, 9);
-    if (temp2 < 0){
-      lcd->write_buffer('-', 3, 10);
+      if (temp2 < 0){
+        lcd->write_buffer('-', 3, 10);
+      }
+      else {
+        lcd->write_buffer(' ', 3, 10);
+      }
+      lcd->write_buffer(temp / 10 + '0', 3, 11);
+      temp = temp % 10;
+      lcd->write_buffer(temp + '0', 3, 12);
     }
     else {
+      lcd->write_buffer(' ', 3, 9);
       lcd->write_buffer(' ', 3, 10);
+      if (temp2 < 0){
+        lcd->write_buffer('-', 3, 11);
+      }
+      else {
+        lcd->write_buffer(' ', 3, 11);
+      }
+      lcd->write_buffer(temp + '0', 3, 12);
     }
-    lcd->write_buffer(temp / 10 + '0', 3, 11);
-    temp = temp % 10;
-    lcd->write_buffer(temp + '0', 3, 12);
-  }
-  else {
-    lcd->write_buffer(' ', 3, 9);
-    lcd->write_buffer(' ', 3, 10);
-    if (temp2 < 0){
-      lcd->write_buffer('-', 3, 11);
-    }
-    else {
-      lcd->write_buffer(' ', 3, 11);
-    }
-    lcd->write_buffer(temp + '0', 3, 12);
   }
-#endif
   
-  if (implement->getSide()){
+  if (_snapshot.side){
     lcd->write_buffer('L', 3, 15);
   }
   else {
     lcd->write_buffer('R', 3, 15);
   }
+
+  // Shown implement
+  if (Features::implements > 1 && implement_count > 1){
+    lcd->write_buffer(implement_page + '1', 3, 19);
+  }
   
   switch (mode){
   case 0: // AUTO
@@ -335,14 +760,8 @@ void InterfacePlough::updateScreen(boolean _rewrite){
     break;
   case 1: // HOLD
     lcd->write_buffer('H', 3, 14);
-    if (gps->minSpeed()){
-      lcd->write_buffer('G', 3, 17);
-      lcd->write_buffer('!', 3, 18);
-    }
-    else{
-      lcd->write_buffer('S', 3, 17);
-      lcd->write_buffer('!', 3, 18);
-    }
+    lcd->write_buffer(getHoldReason(), 3, 17);
+    lcd->write_buffer('!', 3, 18);
     break;
   case 2: // MANUAL
     lcd->write_buffer('M', 3, 14);
@@ -363,23 +782,374 @@ void InterfacePlough::updateScreen(boolean _rewrite){
   }
 }
 
+// ------------------------------------------------------------
+// Control path XTE -> implement in fixed point, no per-tick division:
+//   XTE, estimate, step   Q4   1/16 cm         long
+//   XTE rate              Q4   1/16 cm/s       long
+//   shaped position       Q12  1/4096 cm       long
+//   reciprocal interval   Q16  65536 / ms      unsigned int
+//   time                       ms              unsigned long
+// The ranges below hold for a 32-bit long and a 16-bit int (AVR).
+// ------------------------------------------------------------
+
+// Rate times the longest time it is applied over, as perMille() input
+static_assert(KF_RATE_MAX * 16LL * KF_RESET <= PER_MILLE_MAX,
+              "KF_RATE_MAX * KF_RESET out of perMille() range");
+static_assert(KF_RATE_MAX * 16LL * PREDICT_MAX <= PER_MILLE_MAX,
+              "KF_RATE_MAX * PREDICT_MAX out of perMille() range");
+static_assert(SHAPE_ACCEL * 16LL * 500 <= PER_MILLE_MAX,
+              "SHAPE_ACCEL out of perMille() range");
+
+// Interval sum and reciprocal in an unsigned int
+static_assert(KF_RESET * 2LL <= 0xFFFF && KF_INTERVAL_MIN >= 1,
+              "KF_RESET or KF_INTERVAL_MIN out of unsigned int range");
+
+// Corrections: residual * gain, rate step times reciprocal, fading step
+// times interval * reciprocal (at most 65535)
+static_assert(KF_RESIDUAL_MAX * 16LL * KF_ALPHA + 128 <= 0x7FFFFFFF,
+              "KF_ALPHA correction out of long range");
+static_assert(((KF_RESIDUAL_MAX * 16LL * KF_BETA * 125) >> 5) *
+              (65535 / KF_INTERVAL_MIN) <= 0x7FFFFFFF,
+              "KF_BETA correction out of long range");
+static_assert(((KF_RESIDUAL_MAX * 16LL * KF_ALPHA) >> 8) * 65535 <= 0x7FFFFFFF,
+              "KF_ALPHA step out of long range");
+
+// -------------------------------------------
+// Method for estimating XTE and XTE rate
+// -------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::estimateXte(const PloughSnapshot & _snapshot){
+  unsigned long _fix = _snapshot.xte_fix;
+  unsigned long _interval = _fix - xte_fix;
+  long _residual;
+  long _before;
+
+  if (_fix == xte_fix){
+    return;
+  }
+  xte_fix = _fix;
+
+  // Restart after a gap in fixes
+  if (_interval > KF_RESET){
+    xte_estimate = long(_snapshot.xte) << 4;
+    xte_rate = 0;
+    xte_step = 0;
+    return;
+  }
+
+  // Track the fix interval (GPS rate) for interpolation, its reciprocal is
+  // the only division and runs once per fix
+  xte_interval = (xte_interval + max(_interval, KF_INTERVAL_MIN)) >> 1;
+  xte_recip = 65535U / xte_interval;
+
+  // Predict to the time of the fix, then correct with steady-state gains
+  xte_estimate += perMille(xte_rate * long(_interval));
+  _residual = constrain((long(_snapshot.xte) << 4) - xte_estimate,
+                        -KF_RESIDUAL_MAX * 16L, KF_RESIDUAL_MAX * 16L);
+  _before = xte_estimate;
+
+  xte_estimate += (_residual * KF_ALPHA + 128) >> 8;
+
+  // beta * residual * 1000 / interval, with 1000 / 256 = 125 / 32
+  xte_rate += (((_residual * KF_BETA * 125L) >> 5) * xte_recip) >> 16;
+  xte_rate = constrain(xte_rate, -KF_RATE_MAX * 16L, KF_RATE_MAX * 16L);
+
+  // Spread the correction over the next fix interval instead of a step
+  xte_step = _before - xte_estimate;
+}
+
+// ----------------------------------
+// Method for predicting XTE (AUTO)
+// ----------------------------------
+template <class Features>
+int InterfacePlough<Features>::predictXte(){
+  unsigned long _age = millis() - xte_fix;
+  unsigned long _horizon = _age;
+  long _step = 0;
+
+  // Remainder of the last correction, fading out over one fix interval
+  if (_age < xte_interval){
+    _step = (xte_step * long(xte_interval - _age) * xte_recip) >> 16;
+  }
+
+  // Project over hydraulic lag as well
+  if (Features::predict && mode == 0){
+    _horizon += PREDICT_LATENCY;
+  }
+
+  if (_horizon > PREDICT_MAX){
+    _horizon = PREDICT_MAX;
+  }
+
+  // Q4 estimate to cm, rounded
+  return int((xte_estimate + perMille(xte_rate * long(_horizon)) + _step + 8) >> 4);
+}
+
+// 2 * SHAPE_ACCEL * 16 * 32767 must fit a long
+static_assert(SHAPE_ACCEL <= 2047, "SHAPE_ACCEL above 2047 cm/s2");
+
+// Position step of a 500 ms tick at SHAPE_RATE must fit a long
+static_assert(SHAPE_RATE * 16LL * 500 * 4194 + 0x3FFF <= 0x7FFFFFFF,
+              "SHAPE_RATE above 63 cm/s");
+
+// ------------------------------------------------
+// Method for rate and acceleration limiting (AUTO)
+// ------------------------------------------------
+template <class Features>
+int InterfacePlough<Features>::shapeXte(int _target){
+  unsigned long _now = millis();
+  long _dt = _now - shape_time;
+  long _error, _dv, _desired, _step;
+
+  shape_time = _now;
+
+  if (Features::shape && mode == 0 && _dt < 500){
+    _error = (long(_target) << 4) - (shape_position >> 8);
+    _dv = perMille(SHAPE_ACCEL * 16L * _dt);
+
+    // Saturate to 2047 cm, so the braking product below fits a long. Only
+    // the sign matters that far beyond the stopping distance.
+    _error = constrain(_error, -32767L, 32767L);
+
+    // Brake when the stopping distance v^2 / 2a reaches the remaining error,
+    // this gives S-shaped ramps for large changes. On the target, within
+    // 1/16 cm, only brake.
+    if (_error == 0 ||
+        ((_error >= 0) == (shape_rate >= 0) &&
+         shape_rate * shape_rate >= 2 * SHAPE_ACCEL * 16L * abs(_error))){
+      _desired = 0;
+    }
+    else if (_error > 0){
+      _desired = SHAPE_RATE * 16L;
+    }
+    else {
+      _desired = -SHAPE_RATE * 16L;
+    }
+
+    // Change rate by at most the acceleration limit, Q4 rate * ms to Q12
+    // position is * 256 / 1000, here 4194 / 2^14 (0.007% low). The part
+    // below Q12 is carried to the next tick, so long ramps do not drift.
+    shape_rate = constrain(_desired, shape_rate - _dv, shape_rate + _dv);
+    _step = shape_rate * _dt * 4194L + shape_carry;
+    shape_position += _step >> 14;
+    shape_carry = _step & 0x3FFF;
+
+    // Settle on the target once close and slow
+    if (abs(_error) < 16 && abs(shape_rate) <= _dv){
+      shape_position = long(_target) << 12;
+      shape_rate = 0;
+      shape_carry = 0;
+    }
+    return int((shape_position + 2048) >> 12);
+  }
+
+  // Follow the target outside AUTO, so AUTO starts without a jump
+  shape_position = long(_target) << 12;
+  shape_rate = 0;
+  shape_carry = 0;
+  return _target;
+}
+
+#ifdef LATENCY
+// -----------------------------------------
+// Method for recording fix to valve latency
+// -----------------------------------------
+template <class Features>
+void InterfacePlough<Features>::recordLatency(unsigned int _latency){
+  byte _bin = min(_latency / LATENCY_BIN, LATENCY_BINS - 1);
+
+  // Halve the histogram before a bin overflows, keeps the distribution
+  if (latency_bins[_bin] == 0xFFFF){
+    for (byte i = 0; i < LATENCY_BINS; i++){
+      latency_bins[i] >>= 1;
+    }
+  }
+  latency_bins[_bin]++;
+
+  latency_min = min(latency_min, _latency);
+  latency_max = max(latency_max, _latency);
+  latency_sum += _latency;
+  latency_count++;
+
+  if (latency_count % LATENCY_REPORT == 0){
+    reportLatency();
+  }
+}
+
+// ---------------------------------------------
+// Method for writing latency as CSV over Serial
+// ---------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::reportLatency(){
+  // LAT,fixes,min,mean,max,fix interval,rotation,bins...
+  Serial.print("LAT,");
+  Serial.print(latency_count);
+  Serial.print(',');
+  Serial.print(latency_min);
+  Serial.print(',');
+  Serial.print(latency_sum / latency_count);
+  Serial.print(',');
+  Serial.print(latency_max);
+  Serial.print(',');
+  Serial.print(xte_interval);
+  if (Features::rotation){
+    Serial.print(",1");
+  }
+  else {
+    Serial.print(",0");
+  }
+
+  for (byte i = 0; i < LATENCY_BINS; i++){
+    Serial.print(',');
+    Serial.print(latency_bins[i]);
+  }
+  Serial.println();
+}
+
+// ---------------------------------------------
+// Method for showing latency diagnostics screen
+// ---------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::showLatency(){
+  unsigned int _mean = 0;
+  unsigned int _peak = 1;
+  unsigned int _temp;
+
+  if (latency_count){
+    _mean = latency_sum / latency_count;
+  }
+  for (byte i = 0; i < LATENCY_BINS; i++){
+    _peak = max(_peak, latency_bins[i]);
+  }
+
+  writeText(L_LAT, 0);
+  writeText(L_LAT_AD, 1);
+  writeText(L_BLANK, 2);
+  writeText(L_LAT_HIST, 3);
+
+  if (latency_count){
+    _temp = min(latency_min, 999);
+    lcd->write_buffer(_temp / 100 + '0', 2, 0);
+    lcd->write_buffer(_temp / 10 % 10 + '0', 2, 1);
+    lcd->write_buffer(_temp % 10 + '0', 2, 2);
+    _temp = min(_mean, 999);
+    lcd->write_buffer(_temp / 100 + '0', 2, 7);
+    lcd->write_buffer(_temp / 10 % 10 + '0', 2, 8);
+    lcd->write_buffer(_temp % 10 + '0', 2, 9);
+    _temp = min(latency_max, 999);
+    lcd->write_buffer(_temp / 100 + '0', 2, 14);
+    lcd->write_buffer(_temp / 10 % 10 + '0', 2, 15);
+    lcd->write_buffer(_temp % 10 + '0', 2, 16);
+  }
+
+  // Bin width, right aligned before ms
+  if (LATENCY_BIN >= 100){
+    lcd->write_buffer(LATENCY_BIN / 100 + '0', 3, 0);
+  }
+  if (LATENCY_BIN >= 10){
+    lcd->write_buffer(LATENCY_BIN / 10 % 10 + '0', 3, 1);
+  }
+  lcd->write_buffer(LATENCY_BIN % 10 + '0', 3, 2);
+
+  // One digit per bin, 0 - 9 relative to the fullest bin
+  for (byte i = 0; i < LATENCY_BINS; i++){
+    lcd->write_buffer((unsigned long)latency_bins[i] * 9 / _peak + '0',
+                      3, 12 + i);
+  }
+
+  lcd->write_screen(-1);
+
+  while(checkButtons(0, 0) != 0){
+  }
+  while(checkButtons(0, 0) == 0){
+  }
+}
+#endif
+
+#ifdef PROFILE
+// ---------------------------------------
+// Method for recording one execution time
+// ---------------------------------------
+template <class Features>
+void InterfacePlough<Features>::recordProfile(byte _slot, unsigned long _start){
+  unsigned long _time = PROFILE_CLOCK() - _start;
+
+  profile[_slot].calls++;
+  profile[_slot].total += _time;
+  profile[_slot].max = max(profile[_slot].max, _time);
+}
+
+// -----------------------------------------------------
+// Method for writing execution times as CSV over Serial
+// -----------------------------------------------------
+template <class Features>
+void InterfacePlough<Features>::reportProfile(){
+  static const char * const names[PROFILE_SLOTS] = {
+    "update", "control", "checkButtons", "updateScreen", "write_screen",
+    "calibrate"
+  };
+
+  // PRF,part,calls,mean cycles,max cycles
+  for (byte i = 0; i < PROFILE_SLOTS; i++){
+    if (profile[i].calls == 0){
+      continue;
+    }
+    Serial.print("PRF,");
+    Serial.print(names[i]);
+    Serial.print(',');
+    Serial.print(profile[i].calls);
+    Serial.print(',');
+    Serial.print(profile[i].total / profile[i].calls * PROFILE_CYCLES);
+    Serial.print(',');
+    Serial.println(profile[i].max * PROFILE_CYCLES);
+  }
+}
+#endif
+
+// -------------------------
+// Method for reason of HOLD
+// -------------------------
+template <class Features>
+char InterfacePlough<Features>::getHoldReason(){
+  // Loop overrun, GPS (fix, quality) or speed
+  if (overrun){
+    return 'O';
+  }
+  else if (snapshot.min_speed){
+    return 'G';
+  }
+  return 'S';
+}
+
 // ---------------------------
 // Method for checking buttons
 // ---------------------------
-int InterfacePlough::checkButtons(byte _delay1, byte _delay2){
+template <class Features>
+int InterfacePlough<Features>::checkButtons(byte _delay1, byte _delay2){
+  // Sample clock and pins once, so one call acts on one consistent state.
+  // All timing is done as (now - timer), which stays correct when millis()
+  // wraps around after 49.7 days.
+  unsigned long _now = millis();
+  boolean _left = digitalRead(LEFT_BUTTON);
+  boolean _right = digitalRead(RIGHT_BUTTON);
+
   if (button1_flag){
-    button1_timer = millis();
+    button1_timer = _now;
     button1_flag = false;
   }
   
   if (button2_flag){
-    button2_timer = millis();
+    button2_timer = _now;
     button2_flag = false;
   }
   
   // Check for left/right button presses
-  if(digitalRead(LEFT_BUTTON) && digitalRead(RIGHT_BUTTON)){
-    if(millis() - button1_timer >= _delay1 * 4){
+  if(_left && _right){
+    // A chord never ends in a single press
+    button_chord = true;
+    button_pending = 0;
+
+    if(_now - button1_timer >= _delay1 * 4UL){
       button1_flag = true;
       buttons = 2;
       return 2;
@@ -390,26 +1160,28 @@ int InterfacePlough::checkButtons(byte _delay1, byte _delay2){
       return 0;
     }
   }
-  else if(digitalRead(LEFT_BUTTON)){
-    if(millis() - button2_timer >= _delay2){
+  else if(_left || _right){
+    // Both buttons must be held together for the full delay, holding one
+    // first does not count towards it
+    button1_flag = true;
+
+    if(button_chord){
       button2_flag = true;
-      buttons = -1;
-      return -1;
-    }
-    else{
-      button1_flag = true;
       buttons = 0;
       return 0;
     }
-  }
-  else if(digitalRead(RIGHT_BUTTON)){
-    if(millis() - button2_timer >= _delay2){
+    else if(_now - button2_timer >= _delay2){
       button2_flag = true;
-      buttons = 1;
-      return 1;
+      button_pending = 0;
+      button_repeat = true;
+      buttons = _left ? -1 : 1;
+      return buttons;
     }
     else{
-      button1_flag = true;
+      // Remember a press shorter than the repeat delay
+      if(!button_repeat){
+        button_pending = _left ? -1 : 1;
+      }
       buttons = 0;
       return 0;
     }
@@ -417,31 +1189,56 @@ int InterfacePlough::checkButtons(byte _delay1, byte _delay2){
   else{
     button1_flag = true;
     button2_flag = true;
-    buttons = 0;
-    return 0;
+    button_chord = false;
+    button_repeat = false;
+
+    // Report a short press on release
+    buttons = button_pending;
+    button_pending = 0;
+    return buttons;
   }
 }
 
 // --------------------------------
 // Method for calibrating implement
 // --------------------------------
-void InterfacePlough::calibrate(){
+template <class Features>
+void InterfacePlough<Features>::calibrate(){
+#ifdef PROFILE
+  unsigned long _start = PROFILE_CLOCK();
+#endif
+
   // Stop any adjusting
-  implement->stop();
+  stopImplements();
+
+#ifdef WATCHDOG
+  // Calibration waits on the operator
+  wdt_disable();
+#endif
   
   // Write complete screen
   lcd->write_screen(-1);
   
   // Temporary variables
-  int _temp, _temp2, _temp3;
+  int _temp, _temp2 = 0, _temp3 = 0;
+#ifdef WHEEL_SPEED
+  unsigned long _pulses;
+#endif
   
+#ifdef LATENCY
+  // -------------------
+  // Latency diagnostics
+  // -------------------
+  showLatency();
+#endif
+
   // --------------------
   // Position calibration
   // --------------------
-  lcd->write_buffer(L_CAL_POS, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_POS, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -451,17 +1248,17 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
       
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Width calibration
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_POS_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_POS_AD, 3);
       
       lcd->write_screen(-1);
 
@@ -508,9 +1305,9 @@ void InterfacePlough::calibrate(){
           }
         }
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      lcd->write_buffer(L_BLANK, 3);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
+      writeText(L_BLANK, 3);
 
       lcd->write_screen(-1);
 
@@ -521,10 +1318,10 @@ void InterfacePlough::calibrate(){
 
 #ifdef ROTATION
   // Rotation calibration
-  lcd->write_buffer(L_CAL_ROTATION, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_ROTATION, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -534,17 +1331,17 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
+
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Rotation calibration
-      lcd->write_buffer(L_BLANK, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_ROTATION_AD, 3);
+      writeText(L_BLANK, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_ROTATION_AD, 3);
 
       lcd->write_screen(-1);
 
@@ -552,7 +1349,7 @@ void InterfacePlough::calibrate(){
       for(int i = 0; i < 3; i++){
         _temp = implement->getRotationCalibrationPoint(i);
         _temp2 = _temp / 10;
-        
+
         if (_temp < 0){
           lcd->write_buffer('-', 3, 12);
         }
@@ -571,7 +1368,7 @@ void InterfacePlough::calibrate(){
         while(true){ 
           lcd->write_screen(1);
           checkButtons(0, 0);
-          
+
           if (buttons == 2){
             implement->setRotationCalibrationData(i);
 
@@ -579,9 +1376,9 @@ void InterfacePlough::calibrate(){
           }
         }
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      lcd->write_buffer(L_BLANK, 3);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
+      writeText(L_BLANK, 3);
 
       lcd->write_screen(-1);
 
@@ -591,14 +1388,14 @@ void InterfacePlough::calibrate(){
   delay(1000);
 #endif
 
-#ifdef SPEED_L
+#if defined(SPEED_L) || defined(WHEEL_SPEED)
   // ----------------
   // SPEED calibration
   // ----------------
-  lcd->write_buffer(L_CAL_SPEED, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_SPEED, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -609,53 +1406,91 @@ void InterfacePlough::calibrate(){
 
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      lcd->write_buffer(L_BLANK, 3);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
+      writeText(L_BLANK, 3);
 
       lcd->write_screen(-1);
 
       break;
     }
     else if(checkButtons(0, 0) == 1){
+#ifdef WHEEL_SPEED
+      // Wheel pulses over a measured 100 m
+      writeText(L_CAL_WHEEL, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_WHEEL_AD, 3);
+
+      lcd->write_screen(-1);
+
+      wheel_speed.resetPulses();
+
+      while(checkButtons(0, 0) != 0){
+      }
+
+      // Count loop
+      while(true){
+        lcd->write_screen(1);
+
+        checkButtons(0, 255);
+
+        if (buttons == 2){
+          break;
+        }
+
+        // Pulses so far, five digits
+        _pulses = min(wheel_speed.getPulses(), 65535UL);
+        for (byte i = 0; i < 5; i++){
+          lcd->write_buffer(_pulses % 10 + '0', 3, 18 - i);
+          _pulses /= 10;
+        }
+      }
+
+      // Nothing counted keeps the calibration
+      _pulses = min(wheel_speed.getPulses(), 65535UL);
+      if (_pulses){
+        wheel_speed.setPulses(_pulses);
+      }
+#else
       // Speed calibration
-      lcd->write_buffer(L_BLANK, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_SPEED_AD, 3);
+      writeText(L_BLANK, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_SPEED_AD, 3);
 
       lcd->write_screen(-1);
 
       // Loop through calibration process
       tractor->resetWheelspeedPulses();
-      
+
       while(checkButtons(0, 0) != 0){
       }
 
       // Adjust loop
       while(true){ 
         lcd->write_screen(1);
-  
+
         checkButtons(0, 255);
-        
+
         _temp = tractor->calibrateSpeed(buttons);
 
         if (buttons == 2){
           break;
         }
-        
+
         _temp = _temp / 100;
-        
+
         // Calculate derived variables
         _temp2 = _temp / 10;
         _temp3 = _temp / 100;
-        
+
         lcd->write_buffer(abs(_temp3) + '0', 3, 14);
         lcd->write_buffer(abs(_temp2) % 10 + '0', 3, 15);
         lcd->write_buffer(abs(_temp) % 10 + '0', 3, 16);
       }
-      
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+#endif
+
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_screen(-1);
 
@@ -668,10 +1503,10 @@ void InterfacePlough::calibrate(){
   // -----------------------
   // Adjust number of shares
   // -----------------------
-  lcd->write_buffer(L_CAL_SHARES, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_SHARES, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -681,17 +1516,17 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
       
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust amount of shares
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_SHARES_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_SHARES_AD, 3);
 
       lcd->write_screen(-1);
       
@@ -721,8 +1556,8 @@ void InterfacePlough::calibrate(){
         lcd->write_buffer(_temp2 + '0', 3, 15);
         lcd->write_buffer(_temp % 10 + '0', 3, 16);
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_buffer(_temp2 + '0', 3, 15);
       lcd->write_buffer(_temp % 10 + '0', 3, 16);
@@ -735,14 +1570,105 @@ void InterfacePlough::calibrate(){
   }
   delay(1000);
 
+#ifdef AUTOTUNE
+  // -------------------
+  // Autotune controller
+  // -------------------
+  writeText(L_CAL_TUNE, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
+
+  lcd->write_screen(-1);
+
+  while(checkButtons(0, 0) != 0){
+  }
+
+  while(true){
+    if(checkButtons(0, 0) == -1){
+      // print message to LCD
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
+
+      lcd->write_screen(-1);
+      break;
+    }
+    else if(checkButtons(0, 0) == 1){
+      // Measure step responses
+      writeText(L_CAL_TUNE_RUN, 1);
+      writeText(L_BLANK, 2);
+      writeText(L_BLANK, 3);
+
+      lcd->write_screen(-1);
+
+      while(checkButtons(0, 0) != 0){
+      }
+
+      int _kp, _max;
+      byte _pwm, _error;
+
+      if (!autotune(_kp, _pwm, _error, _max)){
+        writeText(L_CAL_TUNE_FAIL, 1);
+
+        lcd->write_screen(-1);
+        break;
+      }
+
+      // Show proposal
+      writeText(L_CAL_ACCEPT, 1);
+      writeText(L_CAL_DECLINE, 2);
+      writeText(L_CAL_TUNE_AD, 3);
+
+      lcd->write_buffer(_kp / 100 % 10 + '0', 3, 1);
+      lcd->write_buffer(_kp / 10 % 10 + '0', 3, 3);
+      lcd->write_buffer(_kp % 10 + '0', 3, 4);
+      lcd->write_buffer(_pwm / 100 + '0', 3, 7);
+      lcd->write_buffer(_pwm / 10 % 10 + '0', 3, 8);
+      lcd->write_buffer(_pwm % 10 + '0', 3, 9);
+      lcd->write_buffer(_error % 10 + '0', 3, 12);
+      lcd->write_buffer(_max / 10 % 10 + '0', 3, 15);
+      lcd->write_buffer(_max % 10 + '0', 3, 16);
+
+      lcd->write_screen(-1);
+
+      while(checkButtons(0, 0) != 0){
+      }
+
+      while(true){
+        if(checkButtons(0, 0) == -1){
+          writeText(L_CAL_DECLINED, 1);
+          writeText(L_BLANK, 2);
+
+          lcd->write_screen(-1);
+          break;
+        }
+        else if(checkButtons(0, 0) == 1){
+          implement->setKP(_kp);
+          implement->setPwmAuto(_pwm);
+          implement->setError(_error);
+          implement->setMaxCorrection(_max);
+
+          writeText(L_CAL_DONE, 1);
+          writeText(L_BLANK, 2);
+
+          lcd->write_screen(-1);
+          break;
+        }
+      }
+      break;
+    }
+  }
+  delay(1000);
+#endif
+
 #ifdef KP
   // ---------
   // Adjust KP
   // ---------
-  lcd->write_buffer(L_CAL_KP, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_KP, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -752,25 +1678,25 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
+
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust KP
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_KP_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_KP_AD, 3);
 
       lcd->write_screen(-1);
-      
+
       _temp = implement->getKP();
-      
+
       while(checkButtons(0, 0) != 0){
       }
-      
+
       // Adjust loop
       while(true){
         lcd->write_screen(1);
@@ -778,7 +1704,7 @@ void InterfacePlough::calibrate(){
 
         if (buttons == 1){
           _temp ++;
-]        }
+        }
         else if (buttons == -1){
           _temp --;
         }
@@ -796,8 +1722,8 @@ void InterfacePlough::calibrate(){
         lcd->write_buffer(_temp  % 10 + '0', 3, 16);
 
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_buffer(_temp3 + '0', 3, 13);
       lcd->write_buffer('.', 3, 14);
@@ -817,10 +1743,10 @@ void InterfacePlough::calibrate(){
   // -----------------
   // Adjust PWM manual
   // -----------------
-  lcd->write_buffer(L_CAL_PWM_M, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_PWM_M, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -830,29 +1756,29 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
+
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust PWM manual
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_PWM_M_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_PWM_M_AD, 3);
 
       lcd->write_screen(-1);
-      
+
       _temp = implement->getPwmMan();
-      
+
       while(checkButtons(0, 0) != 0){
       }
 
       // Adjust loop
       while(true){
         lcd->write_screen(1);
-        _buttons = checkButtons(0, 255);
+        checkButtons(0, 255);
 
         if (buttons == 1){
           _temp ++;
@@ -870,8 +1796,8 @@ void InterfacePlough::calibrate(){
         lcd->write_buffer(_temp2 + '0', 3, 15);
         lcd->write_buffer(_temp  % 10 + '0', 3, 16);
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_buffer(_temp2 + '0', 3, 15);
       lcd->write_buffer(_temp % 10 + '0', 3, 16);
@@ -889,10 +1815,10 @@ void InterfacePlough::calibrate(){
   // ---------------
   // Adjust PWM auto
   // ---------------
-  lcd->write_buffer(L_CAL_PWM_A, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_PWM_A, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -902,22 +1828,22 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
-      
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
+
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust PWM auto
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_PWM_A_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_PWM_A_AD, 3);
 
       lcd->write_screen(-1);
-      
+
       _temp = implement->getPwmAuto();
-      
+
       while(checkButtons(0, 0) != 0){
       }
 
@@ -942,8 +1868,8 @@ void InterfacePlough::calibrate(){
         lcd->write_buffer(_temp2 + '0', 3, 15);
         lcd->write_buffer(_temp  % 10 + '0', 3, 16);
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_buffer(_temp2 + '0', 3, 15);
       lcd->write_buffer(_temp % 10 + '0', 3, 16);
@@ -960,10 +1886,10 @@ void InterfacePlough::calibrate(){
   // ------------
   // Adjust error
   // ------------
-  lcd->write_buffer(L_CAL_MARGIN, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_MARGIN, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -973,17 +1899,17 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust error
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_MARGIN_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_MARGIN_AD, 3);
 
       lcd->write_screen(-1);
       
@@ -1011,8 +1937,8 @@ void InterfacePlough::calibrate(){
         lcd->write_buffer(_temp2 + '0', 3, 15);
         lcd->write_buffer(_temp % 10 + '0', 3, 16);
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
       
       lcd->write_buffer(_temp2 + '0', 3, 15);
       lcd->write_buffer(_temp % 10 + '0', 3, 16);
@@ -1028,10 +1954,10 @@ void InterfacePlough::calibrate(){
   // -------------------------
   // Adjust maximum correction
   // -------------------------
-  lcd->write_buffer(L_CAL_MAXCOR, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_MAXCOR, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -1041,17 +1967,17 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust maximum correction
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_MAXCOR_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_MAXCOR_AD, 3);
 
       lcd->write_screen(-1);
       
@@ -1082,8 +2008,8 @@ void InterfacePlough::calibrate(){
         lcd->write_buffer(_temp2 % 10 + '0', 3, 15);
         lcd->write_buffer(_temp % 10 + '0', 3, 16);
         }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_buffer(_temp3 + '0', 3, 14);
       lcd->write_buffer(_temp2 % 10 + '0', 3, 15);
@@ -1100,10 +2026,10 @@ void InterfacePlough::calibrate(){
   // -----------------
   // Adjust ploughside
   // -----------------
-  lcd->write_buffer(L_CAL_SWAP, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_SWAP, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -1113,17 +2039,17 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Adjust maximum correction
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
-      lcd->write_buffer(L_CAL_SWAP_AD, 3);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
+      writeText(L_CAL_SWAP_AD, 3);
 
       if (implement->getSide()){
         lcd->write_buffer('L', 3, 16);
@@ -1156,8 +2082,8 @@ void InterfacePlough::calibrate(){
           lcd->write_buffer('R', 3, 16);
         }
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
 
       if (implement->getSide()){
         lcd->write_buffer('L', 3, 16);
@@ -1176,10 +2102,10 @@ void InterfacePlough::calibrate(){
   // ----------
   // Deutz
   // ----------
-  lcd->write_buffer(L_CAL_DEUTZ, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_DEUTZ, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
     lcd->write_screen(-1);
 
@@ -1189,16 +2115,16 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_BLANK, 2);
 
       lcd->write_screen(-1);
       break;
     }
     else if(checkButtons(0, 0) == 1){
       // Setting sim mode
-      lcd->write_buffer(L_CAL_ADJUST, 1);
-      lcd->write_buffer(L_CAL_ENTER, 2);
+      writeText(L_CAL_ADJUST, 1);
+      writeText(L_CAL_ENTER, 2);
       
       lcd->write_screen(-1);
 
@@ -1219,15 +2145,15 @@ void InterfacePlough::calibrate(){
         }
 
         if (_temp){
-          lcd->write_buffer(L_CAL_ON, 3);
+          writeText(L_CAL_ON, 3);
         }
         else {
-          lcd->write_buffer(L_CAL_OFF, 3);
+          writeText(L_CAL_OFF, 3);
         }
 
       }
-      lcd->write_buffer(L_CAL_DONE, 1);
-      lcd->write_buffer(L_BLANK, 2);
+      writeText(L_CAL_DONE, 1);
+      writeText(L_BLANK, 2);
       
       if (_temp){
         tractor->enableDeutz();
@@ -1244,10 +2170,10 @@ void InterfacePlough::calibrate(){
   delay(1000);
   
   // Store calibration data
-  lcd->write_buffer(L_CAL_COMPLETE, 0);
-  lcd->write_buffer(L_CAL_ACCEPT, 1);
-  lcd->write_buffer(L_CAL_DECLINE, 2);
-  lcd->write_buffer(L_BLANK, 3);
+  writeText(L_CAL_COMPLETE, 0);
+  writeText(L_CAL_ACCEPT, 1);
+  writeText(L_CAL_DECLINE, 2);
+  writeText(L_BLANK, 3);
 
   lcd->write_screen(-1);
 
@@ -1257,13 +2183,16 @@ void InterfacePlough::calibrate(){
   while(true){
     if(checkButtons(0, 0) == -1){
       // print message to LCD
-      lcd->write_buffer(L_CAL_DECLINED, 1);
-      lcd->write_buffer(L_CAL_NOSAVE, 2);
+      writeText(L_CAL_DECLINED, 1);
+      writeText(L_CAL_NOSAVE, 2);
 
       lcd->write_screen(-1);
 
       implement->resetCalibration();
       tractor->resetCalibration();
+#ifdef WHEEL_SPEED
+      wheel_speed.resetCalibration();
+#endif
 
       break;
     }
@@ -1271,10 +2200,13 @@ void InterfacePlough::calibrate(){
       // Commit data
       implement->commitCalibration();
       tractor->commitCalibration();
+#ifdef WHEEL_SPEED
+      wheel_speed.commitCalibration();
+#endif
 
       // Print message to LCD
-      lcd->write_buffer(L_CAL_DDONE, 1);
-      lcd->write_buffer(L_CAL_SAVE, 2);
+      writeText(L_CAL_DDONE, 1);
+      writeText(L_CAL_SAVE, 2);
 
       lcd->write_screen(-1);
 
@@ -1284,6 +2216,179 @@ void InterfacePlough::calibrate(){
   delay(1000);
   
   // After calibration rewrite total screen
+  takeSnapshot();
   updateScreen(1);
   lcd->write_screen(-1);  
-}
\ No newline at end of file
+
+#ifdef WATCHDOG
+  wdt_enable(WATCHDOG_TIMEOUT);
+#endif
+
+#ifdef PROFILE
+  recordProfile(PROFILE_CALIBRATE, _start);
+#endif
+}
+
+#ifdef AUTOTUNE
+// ---------------------------------------------------
+// Method for tuning controller from step responses
+// ---------------------------------------------------
+template <class Features>
+boolean InterfacePlough<Features>::autotune(int & _kp,
+                                           byte & _pwm,
+                                           byte & _error,
+                                           int & _max){
+  unsigned int _lag, _lag2, _rate, _rate2, _auto;
+  int _coast, _coast2;
+  byte _deadband;
+  byte _pwm_man = implement->getPwmMan();
+
+  // Only while stationary
+  gps->update();
+  takeSnapshot();
+  if (snapshot.min_speed){
+    return false;
+  }
+
+  // Deadband, then a step out and a step back at manual PWM
+  _deadband = tuneDeadband();
+
+  if (!_deadband ||
+      _deadband >= _pwm_man ||
+      !tuneStep(1, _lag, _rate, _coast) ||
+      !tuneStep(-1, _lag2, _rate2, _coast2)){
+    return false;
+  }
+
+  _lag = (_lag + _lag2) / 2;
+  _rate = (_rate + _rate2) / 2;
+  _coast = max(_coast, _coast2);
+
+  // Rate (mm/s) at which the plough coasts TUNE_COAST cm during the lag
+  _auto = _rate;
+  if (_lag && _auto > TUNE_COAST * 10000UL / _lag){
+    _auto = TUNE_COAST * 10000UL / _lag;
+  }
+
+  // PWM giving that rate, assuming rate is linear above the deadband
+  _pwm = constrain(_deadband + (long)(_pwm_man - _deadband) * _auto / _rate,
+                   _deadband + TUNE_PWM_STEP, 255L);
+
+  // Margin must exceed the coast at auto rate to avoid hunting
+  _error = constrain(1 + (unsigned long)_coast * _auto / _rate, 1, 9);
+
+  // Geometric gain of 1.00, reduced for slow responses
+  _kp = 100000UL / (1000 + _lag);
+
+  // Correction the plough can reach in about 3 s, at most TUNE_COR_SHARE per share
+  _max = constrain(min((unsigned long)_auto * 3 / 10,
+                       (unsigned long)implement->getShares() * TUNE_COR_SHARE),
+                   5, 99);
+
+  return true;
+}
+
+// ---------------------------------------------------
+// Method for finding the lowest PWM that moves plough
+// ---------------------------------------------------
+template <class Features>
+byte InterfacePlough<Features>::tuneDeadband(){
+  byte _pwm_man = implement->getPwmMan();
+  int _start;
+  unsigned long _timer;
+  boolean _moved = false;
+  int _pwm;
+
+  for (_pwm = TUNE_PWM_MIN; _pwm <= 255 && !_moved; _pwm += TUNE_PWM_STEP){
+    implement->setPwmMan(byte(_pwm));
+
+    _start = implement->getPosition();
+    _timer = millis();
+
+    while (millis() - _timer < TUNE_PROBE){
+      gps->update();
+      implement->adjust(1);
+
+      if (implement->getPosition() != _start){
+        _moved = true;
+        break;
+      }
+
+      // Abort on any button
+      if (checkButtons(0, 0) != 0){
+        implement->stop();
+        implement->setPwmMan(_pwm_man);
+        return 0;
+      }
+    }
+    implement->adjust(0);
+    implement->stop();
+  }
+  implement->setPwmMan(_pwm_man);
+
+  if (!_moved){
+    return 0;
+  }
+  return byte(_pwm - TUNE_PWM_STEP);
+}
+
+// ------------------------------------------------
+// Method for measuring one step at manual PWM
+// ------------------------------------------------
+template <class Features>
+boolean InterfacePlough<Features>::tuneStep(int _direction,
+                                            unsigned int & _lag,
+                                            unsigned int & _rate,
+                                            int & _coast){
+  int _start = implement->getPosition();
+  int _travel = 0;
+  unsigned long _timer = millis();
+  unsigned long _moved = 0;
+  unsigned long _now;
+
+  // Drive until the step is complete
+  while (true){
+    gps->update();
+    implement->adjust(_direction);
+
+    _now = millis();
+    _travel = (implement->getPosition() - _start) * _direction;
+
+    if (!_moved && _travel > 0){
+      _moved = _now;
+    }
+
+    if (_travel >= TUNE_STEP ||
+        _now - _timer > TUNE_TIMEOUT ||
+        checkButtons(0, 0) != 0){
+      break;
+    }
+  }
+  implement->adjust(0);
+  implement->stop();
+
+  if (_travel < TUNE_STEP || _now == _moved){
+    return false;
+  }
+
+  _lag = _moved - _timer;
+  _rate = (_travel - 1) * 10000UL / (_now - _moved);
+
+  // Coast after stop
+  _start = implement->getPosition();
+  _timer = millis();
+
+  while (millis() - _timer < TUNE_SETTLE){
+    gps->update();
+  }
+  _coast = (implement->getPosition() - _start) * _direction;
+
+  if (_coast < 0){
+    _coast = 0;
+  }
+  return true;
+}
+#endif
+
+// The feature set of ConfigInterfacePlough.h
+template class InterfacePlough<PloughFeatures>;
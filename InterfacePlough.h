@@ -21,36 +21,296 @@
 #define InterfacePlough_h
 
 #include "LiquidCrystal_I2C.h"
+#include "ConfigInterfacePlough.h"
+#ifdef SIM
+#include "SimPlough.h"
+#ifdef NMEA_STREAM
+#include "NmeaStream.h"
+#endif
+#else
 #include "ImplementPlough.h"
 #include "VehicleTractor.h"
+#ifdef NMEA_STREAM
+#include "NmeaStream.h"
+#else
 #include "VehicleGps.h"
-#include "ConfigInterfacePlough.h"
+#endif
+#endif
 #include "Language.h"
+#ifdef ADC_SAMPLER
+#include "AdcSampler.h"
+#endif
+#ifdef WHEEL_SPEED
+#include "WheelSpeed.h"
+#endif
+#ifdef PACKED_STRINGS
+#include "LanguagePacked.h"
+#endif
+
+// The XTE is only predicted or shaped here when the implement takes it from
+// the interface, update(mode, buttons, xte); else the implement reads the
+// GPS itself with update(mode, buttons)
+#if defined(PREDICT) && !defined(XTE_ESTIMATOR)
+#error "PREDICT needs the rate of XTE_ESTIMATOR"
+#endif
+
+#if defined(XTE_ESTIMATOR) || defined(SHAPE)
+#define INTERFACE_XTE
+#ifndef IMPLEMENT_XTE
+#error "XTE_ESTIMATOR and SHAPE need an implement with update(mode, buttons, xte)"
+#endif
+#endif
+
+// While the sampler runs, analogRead() stops it. The implement has to read
+// its sensors with adc_sampler.read() and say so with IMPLEMENT_ADC_SAMPLER.
+#if defined(ADC_SAMPLER) && !defined(IMPLEMENT_ADC_SAMPLER)
+#error "ADC_SAMPLER needs an implement that reads adc_sampler (IMPLEMENT_ADC_SAMPLER)"
+#endif
+
+// The bin width is shown in three digits on the latency screen
+#if defined(LATENCY) && (LATENCY_BIN < 1 || LATENCY_BIN > 999)
+#error "LATENCY_BIN must be 1 - 999 ms"
+#endif
+
+// Autotune reads PWM manual and sets KP and PWM auto
+#if defined(KP) && defined(PWM_MAN) && defined(PWM_AUTO)
+#define AUTOTUNE
+#endif
+
+// Feature switches as constants, the feature set InterfacePlough is
+// instantiated with. Every branch compiles in every variant, disabled
+// branches are removed by the compiler. Behind #ifdef stay calls into the
+// implement and vehicle libraries (ROTATION, SPEED_L, KP, PWM_MAN,
+// PWM_AUTO, XTE_ESTIMATOR/SHAPE with IMPLEMENT_XTE), those methods may only
+// exist when the macro is defined, and so do avr-libc (WATCHDOG,
+// IDLE_SLEEP), the AVR timers and ADC (WHEEL_SPEED, ADC_SAMPLER) and the
+// clock of the sketch (PROFILE). LATENCY adds members, which a constant
+// cannot take out of the class, and PACKED_STRINGS changes the text macros.
+// extras/linux/combos.sh builds and runs every combination of
+// extras/footprint/combinations.txt on the SIM stand-ins.
+#ifdef ROTATION
+#define FEATURE_ROTATION  true
+#else
+#define FEATURE_ROTATION  false
+#endif
+
+#ifdef XTE_ESTIMATOR
+#define FEATURE_ESTIMATOR true
+#else
+#define FEATURE_ESTIMATOR false
+#endif
+
+#ifdef PREDICT
+#define FEATURE_PREDICT   true
+#else
+#define FEATURE_PREDICT   false
+#endif
+
+#ifdef SHAPE
+#define FEATURE_SHAPE     true
+#else
+#define FEATURE_SHAPE     false
+#endif
+
+#ifdef DEBUG
+#define FEATURE_DEBUG     true
+#else
+#define FEATURE_DEBUG     false
+#endif
+
+struct PloughFeatures {
+  static constexpr bool rotation = FEATURE_ROTATION;
+  static constexpr bool estimator = FEATURE_ESTIMATOR;
+  static constexpr bool predict = FEATURE_PREDICT;
+  static constexpr bool shape = FEATURE_SHAPE;
+  static constexpr bool debug = FEATURE_DEBUG;
+  static constexpr byte implements = IMPLEMENTS;
+};
+
+// Largest |x| of perMille() for a 32-bit long, (2^31 - 2^19) / 1049
+#define PER_MILLE_MAX     2046652L
 
 // Software version of this library
 #define INTERFACE_VERSION 0.2
 
+#ifdef PROFILE
+// Profiled parts of the loop
+#define PROFILE_UPDATE    0
+#define PROFILE_CONTROL   1
+#define PROFILE_BUTTONS   2
+#define PROFILE_SCREEN    3
+#define PROFILE_LCD       4
+#define PROFILE_CALIBRATE 5
+#define PROFILE_SLOTS     6
+
+// Clock of the profiler and CPU cycles per count: micros() on hardware, or
+// a cycle counter of the sketch, as in extras/simavr
+#ifdef PROFILE_CLOCK
+unsigned long PROFILE_CLOCK();
+#ifndef PROFILE_CYCLES
+#define PROFILE_CYCLES    1
+#endif
+#else
+#define PROFILE_CLOCK     micros
+#define PROFILE_CYCLES    (F_CPU / 1000000L)
+#endif
+
+// Execution time of one profiled part (PROFILE_CLOCK counts)
+struct ProfileSlot {
+  unsigned long calls;
+  unsigned long total;
+  unsigned long max;
+};
+#endif
+
+// Sensor values of one tick, read once and shared by control and screen
+struct PloughSnapshot {
+  unsigned long time;
+
+  // Implement
+  int offset;
+  int position;
+  int rotation;
+  boolean side;
+
+  // Tractor and mode switch
+  boolean hitch;
+  boolean manual;
+
+  // GPS
+  int xte;
+  byte quality;
+  boolean min_speed;
+  unsigned long gga_fix;
+  unsigned long vtg_fix;
+  unsigned long xte_fix;
+};
+
+template <class Features = PloughFeatures>
 class InterfacePlough {
+  // Host test of the fixed-point XTE path, extras/linux/xtecheck.cpp
+  friend class XteCheck;
 private:
   //-------------
   // data members
   //-------------
   
   // Mode
-  byte mode; // AUTO, SIM, MANUAL, CALIBRATE
+  byte mode; // AUTO, HOLD, MANUAL, CALIBRATE
   
   // Button flag and timer
   int buttons;
+  int button_pending;
+  bool button_chord;
+  bool button_repeat;
   bool button1_flag;
   bool button2_flag;
   unsigned long button1_timer;
   unsigned long button2_timer;
 
+  // Sensor values of the current tick
+  PloughSnapshot snapshot;
+
+  // XTE estimator, Q4 (1/16 cm and 1/16 cm/s)
+  long xte_estimate;
+  long xte_rate;
+  long xte_step;
+  unsigned long xte_fix;
+  unsigned int xte_interval;
+  unsigned int xte_recip;
+
+  // Command shaping, Q12 position and Q4 rate (1/16 cm/s), Q26 carry
+  long shape_position;
+  long shape_rate;
+  unsigned int shape_carry;
+  unsigned long shape_time;
+
+  // Start of the last full tick
+  unsigned long tick_time;
+
+  // Loop monitor
+  unsigned long loop_time;
+  unsigned long loop_period;
+  unsigned long overrun_time;
+  byte loop_misses;
+  boolean loop_started;
+  boolean overrun;
+
+#ifdef LATENCY
+  // Fix to valve latency (ms)
+  unsigned int latency_bins[LATENCY_BINS];
+  unsigned int latency_min;
+  unsigned int latency_max;
+  unsigned long latency_sum;
+  unsigned long latency_count;
+#endif
+
+#ifdef PROFILE
+  // Execution times
+  ProfileSlot profile[PROFILE_SLOTS];
+  unsigned long profile_time;
+#endif
+
+  // Implements, shown implement and next one to update
+  ImplementPlough * implements[Features::implements];
+  byte implement_count;
+  byte implement_page;
+  byte implement_next;
+  unsigned long page_timer;
+
   // Objects
   LiquidCrystal_I2C * lcd;
-  ImplementPlough * implement;
+  ImplementPlough * implement;  // shown implement
   VehicleTractor * tractor;
   VehicleGps * gps;
+
+  // -------------------------------------------
+  // private member functions for control
+  // -------------------------------------------
+  void checkLoop();
+  boolean idle();
+  void checkPage();
+  void stopImplements();
+  void takeSnapshot();
+  void control(const PloughSnapshot & _snapshot, int _buttons);
+  void estimateXte(const PloughSnapshot & _snapshot);
+
+  // x / 1000 as multiply and shift, 1049 / 2^20 = 0.0010004, rounded
+  static inline long perMille(long _x){
+    return (_x * 1049L + (1L << 19)) >> 20;
+  };
+  int predictXte();
+  int shapeXte(int _target);
+  void writeText(const char * _text, int _row);
+
+#ifdef LATENCY
+  // -------------------------------------------
+  // private member functions for latency
+  // -------------------------------------------
+  void recordLatency(unsigned int _latency);
+  void reportLatency();
+  void showLatency();
+#endif
+
+#ifdef PROFILE
+  // -------------------------------------------
+  // private member functions for profiling
+  // -------------------------------------------
+  void recordProfile(byte _slot, unsigned long _start);
+  void reportProfile();
+#endif
+
+#ifdef AUTOTUNE
+  // -------------------------------------------
+  // private member functions for autotune
+  // -------------------------------------------
+  boolean autotune(int & _kp, byte & _pwm, byte & _error, int & _max);
+  byte tuneDeadband();
+  boolean tuneStep(int _direction,
+                   unsigned int & _lag,
+                   unsigned int & _rate,
+                   int & _coast);
+#endif
 public:
   // ----------------------------------------------------
   // public member functions implemented in InterfacePlough.cpp
@@ -62,6 +322,7 @@ public:
             VehicleTractor * _tractor,
             VehicleGps * _gps);
             
+  boolean addImplement(ImplementPlough * _implement);
   void update();
   void updateScreen(boolean _rewrite);
   int checkButtons(byte _delay1, byte _delay2);
@@ -70,5 +331,23 @@ public:
   inline int getButtons(){
     return buttons;
   };
+  inline byte getImplementPage(){
+    return implement_page;
+  };
+
+  // State of the last tick, for exporting
+  char getHoldReason();
+  inline byte getMode(){
+    return mode;
+  };
+  inline const PloughSnapshot & getSnapshot(){
+    return snapshot;
+  };
+  inline boolean getOverrun(){
+    return overrun;
+  };
+  inline unsigned long getLoopPeriod(){
+    return loop_period;
+  };
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,488 @@
+/*
+  LanguagePacked.cpp - screen texts of language.h, packed
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Generated by extras/strings/packstrings.py from language.h, do not edit.
+ */
+
+#include "Arduino.h"
+
+#include "ConfigInterfacePlough.h"
+#include "Language.h"
+
+#ifdef PACKED_STRINGS
+#include "LanguagePacked.h"
+
+// ------------
+// Taal ENGLISH
+// ------------
+#ifdef ENGLISH
+
+const uint8_t lang_packed[] PROGMEM = {
+  // L_BLANK "                    "
+  0x14,
+  // L_POS "Set width:          "
+  0x53, 0x65, 0x74, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x0a,
+  // L_A_POS "Actual position:    "
+  0x41, 0x63, 0x74, 0x88, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x84, 0x3a, 0x04,
+  // L_XTE "XTE:                "
+  0x58, 0x54, 0x45, 0x3a, 0x10,
+  // L_ROTATION "Rotation:           "
+  0x52, 0x6f, 0x74, 0x61, 0x84, 0x3a, 0x0b,
+  // L_CAL_ACCEPT "+ : accept          "
+  0x2b, 0x20, 0x3a, 0x86, 0x0a,
+  // L_CAL_DECLINE "- : cancel          "
+  0x2d, 0x20, 0x3a, 0x20, 0x8b, 0x0a,
+  // L_CAL_DONE "complete            "
+  0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x0c,
+  // L_CAL_DECLINED "cancelled           "
+  0x8b, 0x6c, 0x65, 0x64, 0x0b,
+  // L_CAL_ADJUST "+ / - : to adjust   "
+  0x2b, 0x20, 0x2f, 0x20, 0x2d, 0x20, 0x3a, 0x8d, 0x20, 0x61, 0x64, 0x6a,
+  0x75, 0x73, 0x74, 0x03,
+  // L_CAL_ENTER "Both  : to accept   "
+  0x42, 0x6f, 0x74, 0x68, 0x02, 0x3a, 0x8d, 0x86, 0x03,
+  // L_CAL_ON "                  on"
+  0x12, 0x6f, 0x6e,
+  // L_CAL_OFF "                 off"
+  0x11, 0x6f, 0x66, 0x66,
+  // L_CAL_POS "Width calibration   "
+  0x57, 0x69, 0x64, 0x74, 0x68, 0x80, 0x03,
+  // L_CAL_POS_AD "Adjust to        cm "
+  0x41, 0x81, 0x74, 0x6f, 0x08, 0x63, 0x6d, 0x20,
+  // L_CAL_ROTATION "Rotation calibration"
+  0x52, 0x6f, 0x74, 0x61, 0x84, 0x80,
+  // L_CAL_ROTATION_AD "Adjust to        deg"
+  0x41, 0x81, 0x74, 0x6f, 0x08, 0x64, 0x65, 0x67,
+  // L_CAL_SHARES "Adjust am. of shares"
+  0x41, 0x81, 0x61, 0x6d, 0x2e, 0x82,
+  // L_CAL_SHARES_AD "Amount of shares:   "
+  0x41, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x82, 0x3a, 0x03,
+  // L_CAL_TUNE "Autotune controller "
+  0x41, 0x75, 0x74, 0x6f, 0x74, 0x75, 0x6e, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x65, 0x72, 0x20,
+  // L_CAL_TUNE_RUN "Tuning, keep still  "
+  0x54, 0x75, 0x6e, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x6b, 0x65, 0x65, 0x70,
+  0x20, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x02,
+  // L_CAL_TUNE_FAIL "failed or aborted   "
+  0x8c, 0x20, 0x6f, 0x72, 0x20, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x65, 0x64,
+  0x03,
+  // L_CAL_TUNE_AD "K .   P    E  M     "
+  0x4b, 0x20, 0x2e, 0x03, 0x50, 0x04, 0x45, 0x02, 0x4d, 0x05,
+  // L_LAT "Latency fix > valve "
+  0x4c, 0x61, 0x74, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x66, 0x69, 0x78, 0x20,
+  0x3e, 0x20, 0x76, 0x61, 0x6c, 0x76, 0x65, 0x20,
+  // L_LAT_AD "min    mean   max ms"
+  0x6d, 0x69, 0x6e, 0x04, 0x6d, 0x65, 0x61, 0x6e, 0x03, 0x6d, 0x61, 0x78,
+  0x20, 0x6d, 0x73,
+  // L_LAT_HIST "   ms bins:         "
+  0x03, 0x6d, 0x73, 0x20, 0x62, 0x69, 0x6e, 0x73, 0x3a, 0x09,
+  // L_CAL_KP "PID adjust KP       "
+  0x50, 0x49, 0x44, 0x20, 0x61, 0x81, 0x4b, 0x50, 0x07,
+  // L_CAL_KP_AD "KP:                 "
+  0x4b, 0x50, 0x3a, 0x11,
+  // L_CAL_PWM_M "PWM adjust manual   "
+  0x83, 0x61, 0x81, 0x6d, 0x61, 0x6e, 0x88, 0x03,
+  // L_CAL_PWM_M_AD "PWM manual:         "
+  0x83, 0x6d, 0x61, 0x6e, 0x88, 0x3a, 0x09,
+  // L_CAL_PWM_A "PWM adjust auto     "
+  0x83, 0x61, 0x81, 0x87, 0x05,
+  // L_CAL_PWM_A_AD "PWM auto:           "
+  0x83, 0x87, 0x3a, 0x0b,
+  // L_CAL_MARGIN "Adjust error margin "
+  0x41, 0x81, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x6d, 0x8a,
+  // L_CAL_MARGIN_AD "Margin :          cm"
+  0x4d, 0x8a, 0x3a, 0x0a, 0x63, 0x6d,
+  // L_CAL_MAXCOR "Adj. max. correction"
+  0x41, 0x64, 0x6a, 0x2e, 0x20, 0x6d, 0x85, 0x65, 0x63, 0x84,
+  // L_CAL_MAXCOR_AD "Max. corr.:       cm"
+  0x4d, 0x85, 0x2e, 0x3a, 0x07, 0x63, 0x6d,
+  // L_CAL_SWAP "Change ploughside   "
+  0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x70, 0x6c, 0x6f, 0x75, 0x67,
+  0x68, 0x73, 0x8e, 0x03,
+  // L_CAL_SWAP_AD "Side:               "
+  0x53, 0x8e, 0x3a, 0x0f,
+  // L_CAL_QUAL "Correct RTK ident.  "
+  0x43, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x52, 0x54, 0x4b, 0x20,
+  0x8e, 0x6e, 0x74, 0x2e, 0x02,
+  // L_CAL_QUAL_AD "Quality:            "
+  0x51, 0x88, 0x69, 0x74, 0x79, 0x3a, 0x0c,
+  // L_CAL_SPEED "Speed calibration   "
+  0x53, 0x70, 0x65, 0x65, 0x64, 0x80, 0x03,
+  // L_CAL_SPEED_AD "Accelerate to 10kph "
+  0x41, 0x63, 0x63, 0x65, 0x6c, 0x65, 0x72, 0x61, 0x74, 0x65, 0x8d, 0x20,
+  0x31, 0x30, 0x6b, 0x70, 0x68, 0x20,
+  // L_CAL_WHEEL "Drive exactly 100 m "
+  0x44, 0x72, 0x69, 0x76, 0x65, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6c,
+  0x79, 0x20, 0x31, 0x30, 0x30, 0x20, 0x6d, 0x20,
+  // L_CAL_WHEEL_AD "Pulses:             "
+  0x50, 0x75, 0x6c, 0x73, 0x65, 0x73, 0x3a, 0x0d,
+  // L_CAL_GPS "GPS autodetect      "
+  0x47, 0x50, 0x53, 0x20, 0x87, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x06,
+  // L_CAL_GPS_DONE "passed              "
+  0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x0e,
+  // L_CAL_GPS_FAIL "failed...           "
+  0x8c, 0x2e, 0x2e, 0x2e, 0x0b,
+  // L_CAL_GPS_M1 "Check cabling and   "
+  0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x63, 0x61, 0x62, 0x6c, 0x69, 0x6e,
+  0x67, 0x20, 0x61, 0x6e, 0x64, 0x03,
+  // L_CAL_GPS_M2 "nmea output         "
+  0x6e, 0x6d, 0x65, 0x61, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x09,
+  // L_CAL_COMPLETE "Finish calibration  "
+  0x46, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x80, 0x02,
+  // L_CAL_NOSAVE "Data NOT saved      "
+  0x44, 0x61, 0x74, 0x61, 0x20, 0x4e, 0x4f, 0x54, 0x89, 0x06,
+  // L_CAL_DDONE "done                "
+  0x64, 0x6f, 0x6e, 0x65, 0x10,
+  // L_CAL_SAVE "Data saved          "
+  0x44, 0x61, 0x74, 0x61, 0x89, 0x0a,
+};
+
+const uint8_t lang_dict[] PROGMEM = {
+  // " calibration"
+  0x20, 0x63, 0x61, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  // "djust "
+  0x64, 0x6a, 0x75, 0x73, 0x74, 0x20,
+  // " of shares"
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x73,
+  // "PWM "
+  0x50, 0x57, 0x4d, 0x20,
+  // "tion"
+  0x74, 0x69, 0x6f, 0x6e,
+  // "ax. corr"
+  0x61, 0x78, 0x2e, 0x20, 0x63, 0x6f, 0x72, 0x72,
+  // " accept"
+  0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
+  // "auto"
+  0x61, 0x75, 0x74, 0x6f,
+  // "ual"
+  0x75, 0x61, 0x6c,
+  // " saved"
+  0x20, 0x73, 0x61, 0x76, 0x65, 0x64,
+  // "argin "
+  0x61, 0x72, 0x67, 0x69, 0x6e, 0x20,
+  // "cancel"
+  0x63, 0x61, 0x6e, 0x63, 0x65, 0x6c,
+  // "failed"
+  0x66, 0x61, 0x69, 0x6c, 0x65, 0x64,
+  // " to"
+  0x20, 0x74, 0x6f,
+  // "ide"
+  0x69, 0x64, 0x65,
+  0
+};
+
+const uint16_t lang_dict_index[] PROGMEM = {
+  0, 12, 18, 28, 32, 36, 44, 51, 55, 58, 64, 70,
+  76, 82, 85, 88,
+};
+
+// ---------------
+// Taal NEDERLANDS
+// ---------------
+#elif defined NEDERLANDS
+
+const uint8_t lang_packed[] PROGMEM = {
+  // L_BLANK "                    "
+  0x14,
+  // L_POS "Ploegbreedte:       "
+  0x50, 0x8b, 0x62, 0x8d, 0x3a, 0x07,
+  // L_A_POS "Actuele positie:    "
+  0x41, 0x63, 0x74, 0x75, 0x93, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69,
+  0x65, 0x3a, 0x04,
+  // L_XTE "XTE:                "
+  0x58, 0x54, 0x45, 0x3a, 0x10,
+  // L_ROTATION "Rotatie:            "
+  0x89, 0x3a, 0x0c,
+  // L_CAL_ACCEPT "+ : accepteren      "
+  0x2b, 0x83, 0x6e, 0x06,
+  // L_CAL_DECLINE "- : annuleren       "
+  0x2d, 0x20, 0x3a, 0x20, 0x92, 0x65, 0x72, 0x65, 0x6e, 0x07,
+  // L_CAL_DONE "voltooid            "
+  0x76, 0x6f, 0x6c, 0x74, 0x6f, 0x6f, 0x69, 0x64, 0x0c,
+  // L_CAL_DECLINED "geannuleerd         "
+  0x67, 0x65, 0x92, 0x8a, 0x64, 0x09,
+  // L_CAL_ADJUST "+ / - : verstellen  "
+  0x2b, 0x20, 0x2f, 0x20, 0x2d, 0x20, 0x3a, 0x20, 0x76, 0x65, 0x72, 0x73,
+  0x74, 0x65, 0x6c, 0x6c, 0x65, 0x6e, 0x02,
+  // L_CAL_ENTER "Beide : accepteren  "
+  0x42, 0x65, 0x69, 0x64, 0x65, 0x83, 0x6e, 0x02,
+  // L_CAL_ON "                 aan"
+  0x11, 0x91,
+  // L_CAL_OFF "                 uit"
+  0x11, 0x75, 0x69, 0x74,
+  // L_CAL_POS "Breedte calibratie  "
+  0x42, 0x8d, 0x20, 0x63, 0x81, 0x02,
+  // L_CAL_POS_AD "Verstel naar     cm "
+  0x85, 0x05, 0x63, 0x6d, 0x20,
+  // L_CAL_ROTATION "Rotatie calibratie  "
+  0x89, 0x20, 0x63, 0x81, 0x02,
+  // L_CAL_ROTATION_AD "Verstel naar     deg"
+  0x85, 0x05, 0x64, 0x65, 0x67,
+  // L_CAL_SHARES "Wijzig aant. scharen"
+  0x80, 0x91, 0x74, 0x2e, 0x87,
+  // L_CAL_SHARES_AD "Aantal scharen:     "
+  0x41, 0x61, 0x6e, 0x74, 0x61, 0x6c, 0x87, 0x3a, 0x05,
+  // L_CAL_TUNE "Regelaar autotune   "
+  0x52, 0x65, 0x67, 0x65, 0x6c, 0x61, 0x61, 0x72, 0x82, 0x74, 0x75, 0x6e,
+  0x65, 0x03,
+  // L_CAL_TUNE_RUN "Afregelen, stilstaan"
+  0x41, 0x66, 0x72, 0x65, 0x67, 0x93, 0x6e, 0x2c, 0x20, 0x73, 0x74, 0x69,
+  0x6c, 0x73, 0x74, 0x91,
+  // L_CAL_TUNE_FAIL "mislukt/afgebroken  "
+  0x8c, 0x2f, 0x61, 0x66, 0x67, 0x65, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x6e,
+  0x02,
+  // L_CAL_TUNE_AD "K .   P    E  M     "
+  0x4b, 0x20, 0x2e, 0x03, 0x50, 0x04, 0x45, 0x02, 0x4d, 0x05,
+  // L_LAT "Vertraging fix>klep "
+  0x56, 0x65, 0x72, 0x74, 0x72, 0x61, 0x67, 0x69, 0x6e, 0x67, 0x20, 0x66,
+  0x69, 0x78, 0x3e, 0x6b, 0x6c, 0x65, 0x70, 0x20,
+  // L_LAT_AD "min    gem.   max ms"
+  0x6d, 0x69, 0x6e, 0x04, 0x67, 0x65, 0x6d, 0x2e, 0x03, 0x6d, 0x61, 0x78,
+  0x20, 0x6d, 0x73,
+  // L_LAT_HIST "   ms klassen:      "
+  0x03, 0x6d, 0x73, 0x20, 0x6b, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x6e, 0x3a,
+  0x06,
+  // L_CAL_KP "PID wijzig KP       "
+  0x50, 0x49, 0x44, 0x20, 0x77, 0x69, 0x6a, 0x7a, 0x69, 0x67, 0x20, 0x4b,
+  0x50, 0x07,
+  // L_CAL_KP_AD "KP:                 "
+  0x4b, 0x50, 0x3a, 0x11,
+  // L_CAL_PWM_M "Wijzig PWM handmatig"
+  0x80, 0x84, 0x67,
+  // L_CAL_PWM_M_AD "PWM handmatig:      "
+  0x84, 0x67, 0x3a, 0x06,
+  // L_CAL_PWM_A "Wijzig PWM automaat "
+  0x80, 0x50, 0x57, 0x4d, 0x82, 0x6d, 0x61, 0x61, 0x74, 0x20,
+  // L_CAL_PWM_A_AD "PWM automaat:       "
+  0x50, 0x57, 0x4d, 0x82, 0x6d, 0x61, 0x61, 0x74, 0x3a, 0x07,
+  // L_CAL_MARGIN "Wijzig foutmarge    "
+  0x80, 0x66, 0x88, 0x04,
+  // L_CAL_MARGIN_AD "Foutmarge :       cm"
+  0x46, 0x88, 0x20, 0x3a, 0x07, 0x63, 0x6d,
+  // L_CAL_MAXCOR "Wijzig max correctie"
+  0x80, 0x6d, 0x61, 0x78, 0x8e, 0x65, 0x63, 0x74, 0x69, 0x65,
+  // L_CAL_MAXCOR_AD "Max. corr.:       cm"
+  0x4d, 0x61, 0x78, 0x2e, 0x8e, 0x2e, 0x3a, 0x07, 0x63, 0x6d,
+  // L_CAL_SWAP "Wijzig ploegzijde   "
+  0x80, 0x70, 0x8b, 0x7a, 0x69, 0x6a, 0x64, 0x65, 0x03,
+  // L_CAL_SWAP_AD "Ploegt naar:        "
+  0x50, 0x8b, 0x74, 0x20, 0x6e, 0x61, 0x61, 0x72, 0x3a, 0x08,
+  // L_CAL_QUAL "Corrigeer RTK ident."
+  0x43, 0x6f, 0x72, 0x72, 0x69, 0x67, 0x8a, 0x20, 0x52, 0x54, 0x4b, 0x20,
+  0x69, 0x64, 0x65, 0x6e, 0x74, 0x2e,
+  // L_CAL_QUAL_AD "Quality:            "
+  0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x3a, 0x0c,
+  // L_CAL_DEUTZ "Inverteer hefsignaal"
+  0x90, 0x74, 0x8a, 0x20, 0x68, 0x65, 0x66, 0x73, 0x69, 0x67, 0x6e, 0x61,
+  0x61, 0x6c,
+  // L_CAL_DEUTZ_AD "Inversie:           "
+  0x90, 0x73, 0x69, 0x65, 0x3a, 0x0b,
+  // L_CAL_SPEED "Snelheids calibratie"
+  0x53, 0x6e, 0x65, 0x6c, 0x68, 0x65, 0x69, 0x64, 0x73, 0x20, 0x63, 0x81,
+  // L_CAL_SPEED_AD "Accelereer tot 10kmh"
+  0x41, 0x63, 0x63, 0x93, 0x72, 0x8a, 0x20, 0x74, 0x6f, 0x74, 0x20, 0x31,
+  0x30, 0x6b, 0x6d, 0x68,
+  // L_CAL_WHEEL "Rij precies 100 m   "
+  0x52, 0x69, 0x6a, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69, 0x65, 0x73, 0x20,
+  0x31, 0x30, 0x30, 0x20, 0x6d, 0x03,
+  // L_CAL_WHEEL_AD "Pulsen:             "
+  0x50, 0x75, 0x6c, 0x73, 0x65, 0x6e, 0x3a, 0x0d,
+  // L_CAL_GPS "GPS autodetect      "
+  0x47, 0x50, 0x53, 0x82, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x06,
+  // L_CAL_GPS_DONE "geslaagd            "
+  0x67, 0x65, 0x73, 0x6c, 0x61, 0x61, 0x67, 0x64, 0x0c,
+  // L_CAL_GPS_FAIL "mislukt...          "
+  0x8c, 0x2e, 0x2e, 0x2e, 0x0a,
+  // L_CAL_GPS_M1 "Check kabels en     "
+  0x43, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x6b, 0x61, 0x62, 0x65, 0x6c, 0x73,
+  0x20, 0x65, 0x6e, 0x05,
+  // L_CAL_GPS_M2 "nmea output         "
+  0x6e, 0x6d, 0x65, 0x61, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x09,
+  // L_CAL_COMPLETE "Calibratie afronden "
+  0x43, 0x81, 0x20, 0x61, 0x66, 0x72, 0x6f, 0x6e, 0x64, 0x65, 0x6e, 0x20,
+  // L_CAL_NOSAVE "Data NIET opgeslagen"
+  0x8f, 0x4e, 0x49, 0x45, 0x54, 0x86,
+  // L_CAL_SAVE "Data is opgeslagen  "
+  0x8f, 0x69, 0x73, 0x86, 0x02,
+};
+
+const uint8_t lang_dict[] PROGMEM = {
+  // "Wijzig "
+  0x57, 0x69, 0x6a, 0x7a, 0x69, 0x67, 0x20,
+  // "alibratie"
+  0x61, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x74, 0x69, 0x65,
+  // " auto"
+  0x20, 0x61, 0x75, 0x74, 0x6f,
+  // " : acceptere"
+  0x20, 0x3a, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x72, 0x65,
+  // "PWM handmati"
+  0x50, 0x57, 0x4d, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6d, 0x61, 0x74, 0x69,
+  // "Verstel naar"
+  0x56, 0x65, 0x72, 0x73, 0x74, 0x65, 0x6c, 0x20, 0x6e, 0x61, 0x61, 0x72,
+  // " opgeslagen"
+  0x20, 0x6f, 0x70, 0x67, 0x65, 0x73, 0x6c, 0x61, 0x67, 0x65, 0x6e,
+  // " scharen"
+  0x20, 0x73, 0x63, 0x68, 0x61, 0x72, 0x65, 0x6e,
+  // "outmarge"
+  0x6f, 0x75, 0x74, 0x6d, 0x61, 0x72, 0x67, 0x65,
+  // "Rotatie"
+  0x52, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x65,
+  // "eer"
+  0x65, 0x65, 0x72,
+  // "loeg"
+  0x6c, 0x6f, 0x65, 0x67,
+  // "mislukt"
+  0x6d, 0x69, 0x73, 0x6c, 0x75, 0x6b, 0x74,
+  // "reedte"
+  0x72, 0x65, 0x65, 0x64, 0x74, 0x65,
+  // " corr"
+  0x20, 0x63, 0x6f, 0x72, 0x72,
+  // "Data "
+  0x44, 0x61, 0x74, 0x61, 0x20,
+  // "Inver"
+  0x49, 0x6e, 0x76, 0x65, 0x72,
+  // "aan"
+  0x61, 0x61, 0x6e,
+  // "annul"
+  0x61, 0x6e, 0x6e, 0x75, 0x6c,
+  // "ele"
+  0x65, 0x6c, 0x65,
+  0
+};
+
+const uint16_t lang_dict_index[] PROGMEM = {
+  0, 7, 16, 21, 33, 45, 57, 68, 76, 84, 91, 94,
+  98, 105, 111, 116, 121, 126, 129, 134, 137,
+};
+
+// ----------
+// Taal DANSK
+// ----------
+#elif defined DANSK
+
+const uint8_t lang_packed[] PROGMEM = {
+  // L_BLANK "                    "
+  0x14,
+  // L_WIDTH "Arbejdsbredde:      "
+  0x41, 0x72, 0x62, 0x65, 0x6a, 0x64, 0x73, 0x62, 0x87, 0x3a, 0x06,
+  // L_A_WIDTH "Aktuelle bredde:    "
+  0x41, 0x6b, 0x74, 0x75, 0x65, 0x6c, 0x6c, 0x65, 0x20, 0x62, 0x87, 0x3a,
+  0x04,
+  // L_SLIP "Slip:              %"
+  0x53, 0x6c, 0x69, 0x70, 0x3a, 0x0e, 0x25,
+  // L_XTE "XTE:                "
+  0x58, 0x54, 0x45, 0x3a, 0x10,
+  // L_CAL_ACCEPT "+ : acceptere       "
+  0x2b, 0x84, 0x80, 0x07,
+  // L_CAL_DECLINE "- : annullere       "
+  0x2d, 0x20, 0x3a, 0x20, 0x88, 0x80, 0x07,
+  // L_CAL_DONE "f?rdig              "
+  0x66, 0x15, 0xe6, 0x72, 0x64, 0x69, 0x67, 0x0e,
+  // L_CAL_DECLINED "annulleret          "
+  0x88, 0x80, 0x74, 0x0a,
+  // L_CAL_ADJUST "+ / - : justere     "
+  0x2b, 0x20, 0x2f, 0x20, 0x2d, 0x20, 0x3a, 0x20, 0x6a, 0x75, 0x73, 0x74,
+  0x80, 0x05,
+  // L_CAL_ENTER "Beide : acceptere   "
+  0x42, 0x65, 0x69, 0x64, 0x65, 0x84, 0x80, 0x03,
+  // L_CAL_WIDTH "Bredde kalibrering  "
+  0x42, 0x87, 0x20, 0x6b, 0x83, 0x02,
+  // L_CAL_WIDTH_AD "Justere til       cm"
+  0x4a, 0x75, 0x73, 0x74, 0x80, 0x20, 0x74, 0x69, 0x6c, 0x07, 0x63, 0x6d,
+  // L_CAL_SHARES "?ndre antal plovjern"
+  0x15, 0xe6, 0x86, 0x61, 0x81, 0x6e,
+  // L_CAL_SHARES_AD "Antal plovjern :    "
+  0x41, 0x81, 0x6e, 0x20, 0x3a, 0x04,
+  // L_CAL_MARGIN "?ndre fejlmargen    "
+  0x15, 0xe6, 0x86, 0x66, 0x85, 0x04,
+  // L_CAL_MARGIN_AD "Fejlmargen :      cm"
+  0x46, 0x85, 0x20, 0x3a, 0x06, 0x63, 0x6d,
+  // L_CAL_MAXCOR "?ndre correction    "
+  0x15, 0xe6, 0x86, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x04,
+  // L_CAL_MAXCOR_AD "Max cor:          cm"
+  0x4d, 0x61, 0x78, 0x20, 0x63, 0x6f, 0x72, 0x3a, 0x0a, 0x63, 0x6d,
+  // L_CAL_SIDE "Corrigeer ploegzijde"
+  0x82, 0x70, 0x6c, 0x6f, 0x65, 0x67, 0x7a, 0x69, 0x6a, 0x64, 0x65,
+  // L_CAL_SIDE_AD "Ploegt nu naar:     "
+  0x50, 0x6c, 0x6f, 0x65, 0x67, 0x74, 0x20, 0x6e, 0x75, 0x20, 0x6e, 0x61,
+  0x61, 0x72, 0x3a, 0x05,
+  // L_CAL_QUAL "Corrigeer RTK ident."
+  0x82, 0x52, 0x54, 0x4b, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x2e,
+  // L_CAL_QUAL_AD "Quality:            "
+  0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x3a, 0x0c,
+  // L_CAL_SPEED "Snelheids calibratie"
+  0x53, 0x6e, 0x65, 0x6c, 0x68, 0x65, 0x69, 0x64, 0x73, 0x20, 0x63, 0x61,
+  0x6c, 0x69, 0x62, 0x72, 0x61, 0x74, 0x69, 0x65,
+  // L_CAL_SPEED_AD "Accelereer tot 10kmh"
+  0x41, 0x63, 0x63, 0x65, 0x6c, 0x80, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x74,
+  0x20, 0x31, 0x30, 0x6b, 0x6d, 0x68,
+  // L_CAL_GPS "GPS autodetect      "
+  0x47, 0x50, 0x53, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x64, 0x65, 0x74, 0x65,
+  0x63, 0x74, 0x06,
+  // L_CAL_GPS_DONE "succesfuld          "
+  0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x66, 0x75, 0x6c, 0x64, 0x0a,
+  // L_CAL_GPS_FAIL "mislykket...        "
+  0x6d, 0x69, 0x73, 0x6c, 0x79, 0x6b, 0x6b, 0x65, 0x74, 0x2e, 0x2e, 0x2e,
+  0x08,
+  // L_CAL_GPS_M1 "Kontrollere kabler  "
+  0x4b, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x6c, 0x80, 0x20, 0x6b, 0x61,
+  0x62, 0x6c, 0x65, 0x72, 0x02,
+  // L_CAL_GPS_M2 "og nmea output      "
+  0x6f, 0x67, 0x20, 0x6e, 0x6d, 0x65, 0x61, 0x20, 0x6f, 0x75, 0x74, 0x70,
+  0x75, 0x74, 0x06,
+  // L_CAL_COMPLETE "Kalibrering f?rdig  "
+  0x4b, 0x83, 0x20, 0x66, 0x15, 0xe6, 0x72, 0x64, 0x69, 0x67, 0x02,
+  // L_CAL_NOSAVE "Data IKKE er gemt   "
+  0x44, 0x61, 0x74, 0x61, 0x20, 0x49, 0x4b, 0x4b, 0x45, 0x20, 0x65, 0x72,
+  0x89, 0x03,
+  // L_CAL_SAVE "Data gemt           "
+  0x44, 0x61, 0x74, 0x61, 0x89, 0x0b,
+};
+
+const uint8_t lang_dict[] PROGMEM = {
+  // "ere"
+  0x65, 0x72, 0x65,
+  // "ntal plovjer"
+  0x6e, 0x74, 0x61, 0x6c, 0x20, 0x70, 0x6c, 0x6f, 0x76, 0x6a, 0x65, 0x72,
+  // "Corrigeer "
+  0x43, 0x6f, 0x72, 0x72, 0x69, 0x67, 0x65, 0x65, 0x72, 0x20,
+  // "alibrering"
+  0x61, 0x6c, 0x69, 0x62, 0x72, 0x65, 0x72, 0x69, 0x6e, 0x67,
+  // " : accept"
+  0x20, 0x3a, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
+  // "ejlmargen"
+  0x65, 0x6a, 0x6c, 0x6d, 0x61, 0x72, 0x67, 0x65, 0x6e,
+  // "ndre "
+  0x6e, 0x64, 0x72, 0x65, 0x20,
+  // "redde"
+  0x72, 0x65, 0x64, 0x64, 0x65,
+  // "annull"
+  0x61, 0x6e, 0x6e, 0x75, 0x6c, 0x6c,
+  // " gemt"
+  0x20, 0x67, 0x65, 0x6d, 0x74,
+  0
+};
+
+const uint16_t lang_dict_index[] PROGMEM = {
+  0, 3, 15, 25, 35, 44, 53, 58, 63, 69, 74,
+};
+
+#endif
+
+#endif
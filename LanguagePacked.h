@@ -0,0 +1,340 @@
+/*
+  LanguagePacked.h - screen texts of language.h, packed
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Generated by extras/strings/packstrings.py from language.h, do not edit.
+ */
+
+#ifndef LanguagePacked_h
+#define LanguagePacked_h
+
+#include <stdint.h>
+
+#define LANG_COLUMNS      20
+#define LANG_RUN_MAX      0x14
+#define LANG_ESCAPE       0x15
+#define LANG_DICT         0x80
+
+extern const uint8_t lang_packed[];
+extern const uint8_t lang_dict[];
+extern const uint16_t lang_dict_index[];
+
+// ------------
+// Taal ENGLISH
+// ------------
+#ifdef ENGLISH
+
+#undef L_BLANK
+#define L_BLANK            ((const char *)lang_packed + 0)
+#undef L_POS
+#define L_POS              ((const char *)lang_packed + 1)
+#undef L_A_POS
+#define L_A_POS            ((const char *)lang_packed + 12)
+#undef L_XTE
+#define L_XTE              ((const char *)lang_packed + 24)
+#undef L_ROTATION
+#define L_ROTATION         ((const char *)lang_packed + 29)
+#undef L_CAL_ACCEPT
+#define L_CAL_ACCEPT       ((const char *)lang_packed + 36)
+#undef L_CAL_DECLINE
+#define L_CAL_DECLINE      ((const char *)lang_packed + 41)
+#undef L_CAL_DONE
+#define L_CAL_DONE         ((const char *)lang_packed + 47)
+#undef L_CAL_DECLINED
+#define L_CAL_DECLINED     ((const char *)lang_packed + 56)
+#undef L_CAL_ADJUST
+#define L_CAL_ADJUST       ((const char *)lang_packed + 61)
+#undef L_CAL_ENTER
+#define L_CAL_ENTER        ((const char *)lang_packed + 77)
+#undef L_CAL_ON
+#define L_CAL_ON           ((const char *)lang_packed + 86)
+#undef L_CAL_OFF
+#define L_CAL_OFF          ((const char *)lang_packed + 89)
+#undef L_CAL_POS
+#define L_CAL_POS          ((const char *)lang_packed + 93)
+#undef L_CAL_POS_AD
+#define L_CAL_POS_AD       ((const char *)lang_packed + 100)
+#undef L_CAL_ROTATION
+#define L_CAL_ROTATION     ((const char *)lang_packed + 108)
+#undef L_CAL_ROTATION_AD
+#define L_CAL_ROTATION_AD  ((const char *)lang_packed + 114)
+#undef L_CAL_SHARES
+#define L_CAL_SHARES       ((const char *)lang_packed + 122)
+#undef L_CAL_SHARES_AD
+#define L_CAL_SHARES_AD    ((const char *)lang_packed + 128)
+#undef L_CAL_TUNE
+#define L_CAL_TUNE         ((const char *)lang_packed + 137)
+#undef L_CAL_TUNE_RUN
+#define L_CAL_TUNE_RUN     ((const char *)lang_packed + 157)
+#undef L_CAL_TUNE_FAIL
+#define L_CAL_TUNE_FAIL    ((const char *)lang_packed + 176)
+#undef L_CAL_TUNE_AD
+#define L_CAL_TUNE_AD      ((const char *)lang_packed + 189)
+#undef L_LAT
+#define L_LAT              ((const char *)lang_packed + 199)
+#undef L_LAT_AD
+#define L_LAT_AD           ((const char *)lang_packed + 219)
+#undef L_LAT_HIST
+#define L_LAT_HIST         ((const char *)lang_packed + 234)
+#undef L_CAL_KP
+#define L_CAL_KP           ((const char *)lang_packed + 244)
+#undef L_CAL_KP_AD
+#define L_CAL_KP_AD        ((const char *)lang_packed + 253)
+#undef L_CAL_PWM_M
+#define L_CAL_PWM_M        ((const char *)lang_packed + 257)
+#undef L_CAL_PWM_M_AD
+#define L_CAL_PWM_M_AD     ((const char *)lang_packed + 265)
+#undef L_CAL_PWM_A
+#define L_CAL_PWM_A        ((const char *)lang_packed + 272)
+#undef L_CAL_PWM_A_AD
+#define L_CAL_PWM_A_AD     ((const char *)lang_packed + 277)
+#undef L_CAL_MARGIN
+#define L_CAL_MARGIN       ((const char *)lang_packed + 281)
+#undef L_CAL_MARGIN_AD
+#define L_CAL_MARGIN_AD    ((const char *)lang_packed + 291)
+#undef L_CAL_MAXCOR
+#define L_CAL_MAXCOR       ((const char *)lang_packed + 297)
+#undef L_CAL_MAXCOR_AD
+#define L_CAL_MAXCOR_AD    ((const char *)lang_packed + 307)
+#undef L_CAL_SWAP
+#define L_CAL_SWAP         ((const char *)lang_packed + 314)
+#undef L_CAL_SWAP_AD
+#define L_CAL_SWAP_AD      ((const char *)lang_packed + 330)
+#undef L_CAL_QUAL
+#define L_CAL_QUAL         ((const char *)lang_packed + 334)
+#undef L_CAL_QUAL_AD
+#define L_CAL_QUAL_AD      ((const char *)lang_packed + 351)
+#undef L_CAL_SPEED
+#define L_CAL_SPEED        ((const char *)lang_packed + 358)
+#undef L_CAL_SPEED_AD
+#define L_CAL_SPEED_AD     ((const char *)lang_packed + 365)
+#undef L_CAL_WHEEL
+#define L_CAL_WHEEL        ((const char *)lang_packed + 383)
+#undef L_CAL_WHEEL_AD
+#define L_CAL_WHEEL_AD     ((const char *)lang_packed + 403)
+#undef L_CAL_GPS
+#define L_CAL_GPS          ((const char *)lang_packed + 411)
+#undef L_CAL_GPS_DONE
+#define L_CAL_GPS_DONE     ((const char *)lang_packed + 423)
+#undef L_CAL_GPS_FAIL
+#define L_CAL_GPS_FAIL     ((const char *)lang_packed + 430)
+#undef L_CAL_GPS_M1
+#define L_CAL_GPS_M1       ((const char *)lang_packed + 435)
+#undef L_CAL_GPS_M2
+#define L_CAL_GPS_M2       ((const char *)lang_packed + 453)
+#undef L_CAL_COMPLETE
+#define L_CAL_COMPLETE     ((const char *)lang_packed + 465)
+#undef L_CAL_NOSAVE
+#define L_CAL_NOSAVE       ((const char *)lang_packed + 473)
+#undef L_CAL_DDONE
+#define L_CAL_DDONE        ((const char *)lang_packed + 483)
+#undef L_CAL_SAVE
+#define L_CAL_SAVE         ((const char *)lang_packed + 488)
+
+// ---------------
+// Taal NEDERLANDS
+// ---------------
+#elif defined NEDERLANDS
+
+#undef L_BLANK
+#define L_BLANK            ((const char *)lang_packed + 0)
+#undef L_POS
+#define L_POS              ((const char *)lang_packed + 1)
+#undef L_A_POS
+#define L_A_POS            ((const char *)lang_packed + 7)
+#undef L_XTE
+#define L_XTE              ((const char *)lang_packed + 22)
+#undef L_ROTATION
+#define L_ROTATION         ((const char *)lang_packed + 27)
+#undef L_CAL_ACCEPT
+#define L_CAL_ACCEPT       ((const char *)lang_packed + 30)
+#undef L_CAL_DECLINE
+#define L_CAL_DECLINE      ((const char *)lang_packed + 34)
+#undef L_CAL_DONE
+#define L_CAL_DONE         ((const char *)lang_packed + 44)
+#undef L_CAL_DECLINED
+#define L_CAL_DECLINED     ((const char *)lang_packed + 53)
+#undef L_CAL_ADJUST
+#define L_CAL_ADJUST       ((const char *)lang_packed + 59)
+#undef L_CAL_ENTER
+#define L_CAL_ENTER        ((const char *)lang_packed + 78)
+#undef L_CAL_ON
+#define L_CAL_ON           ((const char *)lang_packed + 86)
+#undef L_CAL_OFF
+#define L_CAL_OFF          ((const char *)lang_packed + 88)
+#undef L_CAL_POS
+#define L_CAL_POS          ((const char *)lang_packed + 92)
+#undef L_CAL_POS_AD
+#define L_CAL_POS_AD       ((const char *)lang_packed + 98)
+#undef L_CAL_ROTATION
+#define L_CAL_ROTATION     ((const char *)lang_packed + 103)
+#undef L_CAL_ROTATION_AD
+#define L_CAL_ROTATION_AD  ((const char *)lang_packed + 108)
+#undef L_CAL_SHARES
+#define L_CAL_SHARES       ((const char *)lang_packed + 113)
+#undef L_CAL_SHARES_AD
+#define L_CAL_SHARES_AD    ((const char *)lang_packed + 118)
+#undef L_CAL_TUNE
+#define L_CAL_TUNE         ((const char *)lang_packed + 127)
+#undef L_CAL_TUNE_RUN
+#define L_CAL_TUNE_RUN     ((const char *)lang_packed + 141)
+#undef L_CAL_TUNE_FAIL
+#define L_CAL_TUNE_FAIL    ((const char *)lang_packed + 157)
+#undef L_CAL_TUNE_AD
+#define L_CAL_TUNE_AD      ((const char *)lang_packed + 170)
+#undef L_LAT
+#define L_LAT              ((const char *)lang_packed + 180)
+#undef L_LAT_AD
+#define L_LAT_AD           ((const char *)lang_packed + 200)
+#undef L_LAT_HIST
+#define L_LAT_HIST         ((const char *)lang_packed + 215)
+#undef L_CAL_KP
+#define L_CAL_KP           ((const char *)lang_packed + 228)
+#undef L_CAL_KP_AD
+#define L_CAL_KP_AD        ((const char *)lang_packed + 242)
+#undef L_CAL_PWM_M
+#define L_CAL_PWM_M        ((const char *)lang_packed + 246)
+#undef L_CAL_PWM_M_AD
+#define L_CAL_PWM_M_AD     ((const char *)lang_packed + 249)
+#undef L_CAL_PWM_A
+#define L_CAL_PWM_A        ((const char *)lang_packed + 253)
+#undef L_CAL_PWM_A_AD
+#define L_CAL_PWM_A_AD     ((const char *)lang_packed + 263)
+#undef L_CAL_MARGIN
+#define L_CAL_MARGIN       ((const char *)lang_packed + 273)
+#undef L_CAL_MARGIN_AD
+#define L_CAL_MARGIN_AD    ((const char *)lang_packed + 277)
+#undef L_CAL_MAXCOR
+#define L_CAL_MAXCOR       ((const char *)lang_packed + 284)
+#undef L_CAL_MAXCOR_AD
+#define L_CAL_MAXCOR_AD    ((const char *)lang_packed + 294)
+#undef L_CAL_SWAP
+#define L_CAL_SWAP         ((const char *)lang_packed + 304)
+#undef L_CAL_SWAP_AD
+#define L_CAL_SWAP_AD      ((const char *)lang_packed + 313)
+#undef L_CAL_QUAL
+#define L_CAL_QUAL         ((const char *)lang_packed + 323)
+#undef L_CAL_QUAL_AD
+#define L_CAL_QUAL_AD      ((const char *)lang_packed + 341)
+#undef L_CAL_DEUTZ
+#define L_CAL_DEUTZ        ((const char *)lang_packed + 350)
+#undef L_CAL_DEUTZ_AD
+#define L_CAL_DEUTZ_AD     ((const char *)lang_packed + 364)
+#undef L_CAL_SPEED
+#define L_CAL_SPEED        ((const char *)lang_packed + 370)
+#undef L_CAL_SPEED_AD
+#define L_CAL_SPEED_AD     ((const char *)lang_packed + 382)
+#undef L_CAL_WHEEL
+#define L_CAL_WHEEL        ((const char *)lang_packed + 398)
+#undef L_CAL_WHEEL_AD
+#define L_CAL_WHEEL_AD     ((const char *)lang_packed + 416)
+#undef L_CAL_GPS
+#define L_CAL_GPS          ((const char *)lang_packed + 424)
+#undef L_CAL_GPS_DONE
+#define L_CAL_GPS_DONE     ((const char *)lang_packed + 435)
+#undef L_CAL_GPS_FAIL
+#define L_CAL_GPS_FAIL     ((const char *)lang_packed + 444)
+#undef L_CAL_GPS_M1
+#define L_CAL_GPS_M1       ((const char *)lang_packed + 449)
+#undef L_CAL_GPS_M2
+#define L_CAL_GPS_M2       ((const char *)lang_packed + 465)
+#undef L_CAL_COMPLETE
+#define L_CAL_COMPLETE     ((const char *)lang_packed + 477)
+#undef L_CAL_NOSAVE
+#define L_CAL_NOSAVE       ((const char *)lang_packed + 489)
+#undef L_CAL_DDONE
+#define L_CAL_DDONE        ((const char *)lang_packed + 435)
+#undef L_CAL_SAVE
+#define L_CAL_SAVE         ((const char *)lang_packed + 495)
+
+// ----------
+// Taal DANSK
+// ----------
+#elif defined DANSK
+
+#undef L_BLANK
+#define L_BLANK            ((const char *)lang_packed + 0)
+#undef L_WIDTH
+#define L_WIDTH            ((const char *)lang_packed + 1)
+#undef L_A_WIDTH
+#define L_A_WIDTH          ((const char *)lang_packed + 12)
+#undef L_SLIP
+#define L_SLIP             ((const char *)lang_packed + 25)
+#undef L_XTE
+#define L_XTE              ((const char *)lang_packed + 32)
+#undef L_CAL_ACCEPT
+#define L_CAL_ACCEPT       ((const char *)lang_packed + 37)
+#undef L_CAL_DECLINE
+#define L_CAL_DECLINE      ((const char *)lang_packed + 41)
+#undef L_CAL_DONE
+#define L_CAL_DONE         ((const char *)lang_packed + 48)
+#undef L_CAL_DECLINED
+#define L_CAL_DECLINED     ((const char *)lang_packed + 56)
+#undef L_CAL_ADJUST
+#define L_CAL_ADJUST       ((const char *)lang_packed + 60)
+#undef L_CAL_ENTER
+#define L_CAL_ENTER        ((const char *)lang_packed + 74)
+#undef L_CAL_WIDTH
+#define L_CAL_WIDTH        ((const char *)lang_packed + 82)
+#undef L_CAL_WIDTH_AD
+#define L_CAL_WIDTH_AD     ((const char *)lang_packed + 88)
+#undef L_CAL_SHARES
+#define L_CAL_SHARES       ((const char *)lang_packed + 100)
+#undef L_CAL_SHARES_AD
+#define L_CAL_SHARES_AD    ((const char *)lang_packed + 106)
+#undef L_CAL_MARGIN
+#define L_CAL_MARGIN       ((const char *)lang_packed + 112)
+#undef L_CAL_MARGIN_AD
+#define L_CAL_MARGIN_AD    ((const char *)lang_packed + 118)
+#undef L_CAL_MAXCOR
+#define L_CAL_MAXCOR       ((const char *)lang_packed + 125)
+#undef L_CAL_MAXCOR_AD
+#define L_CAL_MAXCOR_AD    ((const char *)lang_packed + 139)
+#undef L_CAL_SIDE
+#define L_CAL_SIDE         ((const char *)lang_packed + 150)
+#undef L_CAL_SIDE_AD
+#define L_CAL_SIDE_AD      ((const char *)lang_packed + 161)
+#undef L_CAL_QUAL
+#define L_CAL_QUAL         ((const char *)lang_packed + 177)
+#undef L_CAL_QUAL_AD
+#define L_CAL_QUAL_AD      ((const char *)lang_packed + 188)
+#undef L_CAL_SPEED
+#define L_CAL_SPEED        ((const char *)lang_packed + 197)
+#undef L_CAL_SPEED_AD
+#define L_CAL_SPEED_AD     ((const char *)lang_packed + 217)
+#undef L_CAL_GPS
+#define L_CAL_GPS          ((const char *)lang_packed + 235)
+#undef L_CAL_GPS_DONE
+#define L_CAL_GPS_DONE     ((const char *)lang_packed + 250)
+#undef L_CAL_GPS_FAIL
+#define L_CAL_GPS_FAIL     ((const char *)lang_packed + 261)
+#undef L_CAL_GPS_M1
+#define L_CAL_GPS_M1       ((const char *)lang_packed + 274)
+#undef L_CAL_GPS_M2
+#define L_CAL_GPS_M2       ((const char *)lang_packed + 291)
+#undef L_CAL_COMPLETE
+#define L_CAL_COMPLETE     ((const char *)lang_packed + 306)
+#undef L_CAL_DDONE
+#define L_CAL_DDONE        ((const char *)lang_packed + 48)
+#undef L_CAL_NOSAVE
+#define L_CAL_NOSAVE       ((const char *)lang_packed + 317)
+#undef L_CAL_SAVE
+#define L_CAL_SAVE         ((const char *)lang_packed + 331)
+
+#endif
+
+#endif
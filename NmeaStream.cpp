@@ -0,0 +1,258 @@
+/*
+  NmeaStream - bounded, incremental NMEA reader for the MeijWorks interface
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NmeaStream.h"
+
+// Tokenizer states
+#define NMEA_IDLE         0
+#define NMEA_BODY         1
+#define NMEA_CHECK1       2
+#define NMEA_CHECK2       3
+#define NMEA_END          4
+
+// Largest mantissa, six figures: times 1852 (nautical mile) it still fits
+// a long
+#define NMEA_MANTISSA_MAX 999999L
+
+// Sentence types, last three characters of the address field
+#define NMEA_GGA          0x474741UL
+#define NMEA_VTG          0x565447UL
+#define NMEA_XTE          0x585445UL
+
+// -----------
+// Constructor
+// -----------
+NmeaStream::NmeaStream(Stream * _stream){
+  stream = _stream;
+
+  state = NMEA_IDLE;
+
+  quality = 0;
+  speed = 0;
+  xte = 0;
+  gga_fix = 0;
+  vtg_fix = 0;
+  xte_fix = 0;
+}
+
+// ---------------------------------------------
+// Method for reading at most NMEA_BUDGET bytes
+// ---------------------------------------------
+void NmeaStream::update(){
+  byte _budget = NMEA_BUDGET;
+
+  // A burst of sentences is spread over several calls, parsing resumes
+  // wherever the previous call stopped
+  while (_budget-- && stream->available() > 0){
+    parse(stream->read());
+  }
+}
+
+// ----------------------------------
+// Method for parsing a single byte
+// ----------------------------------
+void NmeaStream::parse(char _c){
+  byte _hex;
+
+  switch (_c){
+  case '$':
+    state = NMEA_BODY;
+    field = 0;
+    checksum = 0;
+    type = 0;
+    mantissa = 0;
+    decimals = 0;
+    digits = 0;
+    point = false;
+    symbol = 0;
+    xte_valid_p = false;
+    return;
+  case ',':
+    if (state == NMEA_BODY){
+      checksum ^= _c;
+      closeField();
+      if (field < 255){
+        field++;
+      }
+    }
+    return;
+  case '*':
+    if (state == NMEA_BODY){
+      closeField();
+      received = 0;
+      state = NMEA_CHECK1;
+    }
+    return;
+  case '\r':
+  case '\n':
+    if (state == NMEA_END && received == checksum){
+      publish();
+    }
+    state = NMEA_IDLE;
+    return;
+  }
+
+  switch (state){
+  case NMEA_BODY:
+    checksum ^= _c;
+
+    if (field == 0){
+      type = ((type << 8) | byte(_c)) & 0xFFFFFFUL;
+    }
+    else if (_c >= '0' && _c <= '9'){
+      // At most 6 figures and 5 decimals; further decimals are dropped,
+      // a larger whole number saturates
+      digits++;
+      if (mantissa <= NMEA_MANTISSA_MAX / 10 && (!point || decimals < 5)){
+        mantissa = mantissa * 10 + (_c - '0');
+        if (point){
+          decimals++;
+        }
+      }
+      else if (!point){
+        mantissa = NMEA_MANTISSA_MAX;
+      }
+    }
+    else if (_c == '.'){
+      point = true;
+    }
+    else {
+      symbol = _c;
+    }
+    break;
+  case NMEA_CHECK1:
+  case NMEA_CHECK2:
+    if (_c >= '0' && _c <= '9'){
+      _hex = _c - '0';
+    }
+    else if (_c >= 'A' && _c <= 'F'){
+      _hex = _c - 'A' + 10;
+    }
+    else {
+      state = NMEA_IDLE;
+      return;
+    }
+    received = (received << 4) | _hex;
+    state++;
+    break;
+  default:
+    // Garbage outside a sentence or after the checksum
+    state = NMEA_IDLE;
+    break;
+  }
+}
+
+// ---------------------------------------------
+// Method for storing a completed field
+// ---------------------------------------------
+void NmeaStream::closeField(){
+  long _speed;
+
+  switch (type){
+  case NMEA_GGA:
+    if (field == 6){
+      quality_p = byte(mantissa);
+    }
+    break;
+  case NMEA_VTG:
+    // Speed over ground in km/h, kept as 0.1 km/h
+    if (field == 7){
+      _speed = mantissa;
+      if (decimals == 0){
+        _speed *= 10;
+      }
+      while (decimals-- > 1){
+        _speed /= 10;
+      }
+      speed_p = int(min(_speed, 32767L));
+    }
+    break;
+  case NMEA_XTE:
+    // Only data valid (A) in both status fields, a value and, when the
+    // mode field is sent, not data not valid (N)
+    if (field == 1){
+      xte_valid_p = symbol == 'A';
+    }
+    else if (field == 2){
+      xte_valid_p = xte_valid_p && symbol == 'A';
+    }
+    else if (field == 3){
+      xte_valid_p = xte_valid_p && digits;
+      xte_p = mantissa;
+      xte_decimals_p = decimals;
+    }
+    else if (field == 4){
+      xte_direction_p = symbol;
+    }
+    else if (field == 5){
+      xte_units_p = symbol;
+    }
+    else if (field == 6 && symbol == 'N'){
+      xte_valid_p = false;
+    }
+    break;
+  }
+
+  mantissa = 0;
+  decimals = 0;
+  digits = 0;
+  point = false;
+  symbol = 0;
+}
+
+// ---------------------------------------------
+// Method for publishing a checked sentence
+// ---------------------------------------------
+void NmeaStream::publish(){
+  long _xte;
+
+  switch (type){
+  case NMEA_GGA:
+    quality = quality_p;
+    gga_fix = millis();
+    break;
+  case NMEA_VTG:
+    speed = speed_p;
+    vtg_fix = millis();
+    break;
+  case NMEA_XTE:
+    if (!xte_valid_p){
+      break;
+    }
+
+    // Nautical miles (1852 m) or kilometres, to cm. Beyond 327 m the
+    // result saturates, it is limited before scaling up.
+    _xte = xte_p * (xte_units_p == 'K' ? 1000 : 1852);
+
+    if (xte_decimals_p < 2){
+      _xte = min(_xte, 3276700L) * (xte_decimals_p ? 10 : 100);
+    }
+    while (xte_decimals_p-- > 2){
+      _xte /= 10;
+    }
+
+    // Steer left means the vehicle is right of the line
+    if (xte_direction_p == 'R'){
+      _xte = -_xte;
+    }
+    xte = constrain(_xte, -32767L, 32767L);
+    xte_fix = millis();
+    break;
+  }
+}
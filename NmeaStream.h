@@ -0,0 +1,127 @@
+/*
+  NmeaStream - bounded, incremental NMEA reader for the MeijWorks interface
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NmeaStream_h
+#define NmeaStream_h
+
+#include "Arduino.h"
+#include "ConfigInterfacePlough.h"
+
+// Fixes are stamped on simulated time as well
+#ifdef SIM
+#include "SimPlough.h"
+#endif
+
+// Maximum bytes handled per update()
+#ifndef NMEA_BUDGET
+#define NMEA_BUDGET       32
+#endif
+
+// Speed (0.1 km/h) below which minSpeed() is false
+#ifndef NMEA_MIN_SPEED
+#define NMEA_MIN_SPEED    20
+#endif
+
+// Reads GGA, VTG and XTE sentences from a Stream one byte at a time, without
+// a sentence buffer. Fields are converted as they arrive, the checksum is
+// accumulated on the fly and values are only published once the complete
+// sentence has checked out. Getters match VehicleGps.
+class NmeaStream {
+private:
+  //-------------
+  // data members
+  //-------------
+  Stream * stream;
+
+  // Tokenizer
+  byte state;
+  byte field;
+  byte checksum;
+  byte received;
+  unsigned long type;
+
+  // Current field
+  long mantissa;
+  byte decimals;
+  byte digits;
+  boolean point;
+  char symbol;
+
+  // Pending values of the current sentence
+  byte quality_p;
+  int speed_p;
+  long xte_p;
+  byte xte_decimals_p;
+  char xte_direction_p;
+  char xte_units_p;
+  boolean xte_valid_p;
+
+  // Published values
+  byte quality;
+  int speed;
+  int xte;
+  unsigned long gga_fix;
+  unsigned long vtg_fix;
+  unsigned long xte_fix;
+
+  // -------------------------------------------
+  // private member functions
+  // -------------------------------------------
+  void closeField();
+  void publish();
+public:
+  // ----------------------------------------------------
+  // public member functions implemented in NmeaStream.cpp
+  // ----------------------------------------------------
+
+  // Constructor
+  NmeaStream(Stream * _stream);
+
+  void update();
+  void parse(char _c);
+
+  inline int getXte(){
+    return xte;
+  };
+  inline unsigned long getGgaFixAge(){
+    return gga_fix;
+  };
+  inline unsigned long getVtgFixAge(){
+    return vtg_fix;
+  };
+  inline unsigned long getXteFixAge(){
+    return xte_fix;
+  };
+  inline byte getQuality(){
+    return quality;
+  };
+  inline int getSpeed(){
+    return speed;
+  };
+  inline boolean minSpeed(){
+    return speed >= NMEA_MIN_SPEED;
+  };
+};
+
+#ifdef NMEA_STREAM
+// Interface reads NMEA itself instead of through VehicleGps
+typedef NmeaStream VehicleGps;
+#endif
+
+#endif
@@ -0,0 +1,420 @@
+/*
+  SimPlough - closed loop plough/tractor simulator for the MeijWorks interface
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SimPlough.h"
+#include "Language.h"
+
+#ifdef SIM
+
+// ---------------------------
+// Default scripted field pass
+// ---------------------------
+const SimSegment SIM_PASS[] PROGMEM = {
+  // ms     0.1kmh  xte  ampl  period
+  {  3000,    0,     0,    0,    0 },  // standing at headland
+  { 10000,  100,     0,    0,    0 },  // straight, 10 km/h
+  { 10000,  100,    10,    0,    0 },  // step +10 cm
+  { 10000,  100,   -10,    0,    0 },  // step -20 cm
+  { 20000,  120,     0,    8,   80 },  // contour sway, 12 km/h
+  {  3000,    0,     0,    0,    0 }   // stop at headland
+};
+const byte SIM_PASS_SEGMENTS = sizeof(SIM_PASS) / sizeof(SimSegment);
+
+SIM_LOCAL SimField * SimField::active = 0;
+
+// -----------
+// Constructor
+// -----------
+SimField::SimField(const SimSegment * _script, byte _segments){
+  script = _script;
+  segments = _segments;
+
+  time = 0;
+  drive = 0;
+  automatic = false;
+  shares = 5;
+  quiet = false;
+  realtime = true;
+  clock = (millis)();
+
+  previous = active;
+  active = this;
+  passes = 0;
+
+  speed = 0;
+  xte = 0;
+  distance = 0;
+
+  position = 0;
+  rate = 0;
+  rotation = 0;
+
+  gps_xte = 0;
+  gps_fix = 0;
+
+  reset();
+}
+
+// ----------
+// Destructor
+// ----------
+SimField::~SimField(){
+  active = previous;
+}
+
+// ----------------------------------------
+// Method for reading simulated time (ms)
+// ----------------------------------------
+unsigned long SimField::now(){
+  if (!active){
+    return (millis)();
+  }
+
+  // Keep real-time simulation current even where nothing calls gps->update()
+  if (active->realtime){
+    active->step();
+  }
+  return active->time;
+}
+
+// ----------------------------------
+// Method for restarting a field pass
+// ----------------------------------
+void SimField::reset(){
+  segment = 0;
+  segment_start = time;
+  distance = 0;
+
+  step_size = 0;
+  overshoot = 0;
+  settle_start = time;
+  settle_last = time;
+  settle_max = 0;
+  overshoot_max = 0;
+  sum_sq = 0;
+  samples = 0;
+  effort_sum = 0;
+
+  // Every pass sees the same GPS noise
+  gps_seed = 1;
+}
+
+// ----------------------------------
+// Method for closing the scored step
+// ----------------------------------
+void SimField::closeStep(){
+  float _overshoot;
+
+  if (step_size != 0){
+    if (settle_last - settle_start > settle_max){
+      settle_max = settle_last - settle_start;
+    }
+    _overshoot = overshoot * 100 / fabs(step_size);
+    if (_overshoot > overshoot_max){
+      overshoot_max = _overshoot;
+    }
+  }
+  step_size = 0;
+}
+
+// -----------------------------------------------------------
+// Method for GPS jitter, own generator so fields are isolated
+// -----------------------------------------------------------
+int SimField::noise(){
+  gps_seed = (gps_seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+  return int((gps_seed >> 16) % (2 * SIM_GPS_NOISE + 1)) - SIM_GPS_NOISE;
+}
+
+// -------------------------------------
+// Method for moving to the next segment
+// -------------------------------------
+void SimField::loadSegment(){
+  closeStep();
+
+  // Open new step (sway segments are not scored as a step)
+  if (!pgm_read_word(&script[segment].amplitude)){
+    step_size = int16_t(pgm_read_word(&script[segment].xte)) -
+                int16_t(pgm_read_word(&script[segment - 1].xte));
+  }
+  overshoot = 0;
+  segment_start = time;
+  settle_start = time;
+  settle_last = time;
+}
+
+// ------------------------------------
+// Method for updating simulated world
+// ------------------------------------
+void SimField::step(){
+  if (!realtime){
+    advance();
+    return;
+  }
+
+  // Catch up with real time so timings measured by the interface hold
+  while ((millis)() - clock >= SIM_STEP){
+    clock += SIM_STEP;
+    advance();
+  }
+}
+
+// ------------------------------------
+// Method for advancing simulation step
+// ------------------------------------
+void SimField::advance(){
+  unsigned int _duration;
+  int _amplitude;
+  int _period;
+  int _pwm;
+  float _rate;
+
+  time += SIM_STEP;
+
+  // Script
+  _duration = pgm_read_word(&script[segment].duration);
+
+  if (time - segment_start >= _duration){
+    segment++;
+
+    if (segment >= segments){
+      report();
+      reset();
+      passes++;
+    }
+    else {
+      loadSegment();
+    }
+  }
+
+  // Tractor
+  _rate = int16_t(pgm_read_word(&script[segment].speed)) * 2.778;
+  speed += (_rate - speed) * SIM_STEP / 1000.0;
+  distance += speed * SIM_STEP / 1000.0;
+
+  xte = int16_t(pgm_read_word(&script[segment].xte));
+  _amplitude = pgm_read_word(&script[segment].amplitude);
+  _period = pgm_read_word(&script[segment].period);
+
+  if (_amplitude && _period){
+    xte += _amplitude * sin(2 * PI * (time - segment_start) / (_period * 100.0));
+  }
+
+  // Valve and cylinder
+  _pwm = abs(drive);
+  _rate = 0;
+
+  if (_pwm > SIM_DEADBAND){
+    // Heavier ploughs move slower, rate is specified for 5 shares
+    _rate = SIM_RATE * (_pwm - SIM_DEADBAND) / (255 - SIM_DEADBAND) *
+            5 / (shares ? shares : 1);
+    if (drive < 0){
+      _rate = -_rate;
+    }
+  }
+  rate += (_rate - rate) * SIM_STEP / SIM_VALVE_TAU;
+  position += rate * SIM_STEP / 1000.0;
+
+  if (position > SIM_STROKE){
+    position = SIM_STROKE;
+    rate = 0;
+  }
+  else if (position < -SIM_STROKE){
+    position = -SIM_STROKE;
+    rate = 0;
+  }
+  rotation += (position * SIM_ROT_PER_CM - rotation) * SIM_STEP / SIM_ROT_TAU;
+
+  // GPS epoch
+  if (time % SIM_GPS_EPOCH == 0){
+    gps_xte = xte < 0 ? int(xte - 0.5) : int(xte + 0.5);
+    gps_xte += noise();
+    gps_fix = time;
+  }
+
+  // Score while working
+  if (automatic && getSpeed() >= SIM_MIN_SPEED){
+    score(xte - position);
+  }
+}
+
+// ---------------------------------
+// Method for scoring tracking error
+// ---------------------------------
+void SimField::score(float _error){
+  sum_sq += _error * _error;
+  effort_sum += abs(drive);
+  samples++;
+
+  if (step_size != 0){
+    if (fabs(_error) > SIM_SETTLE_BAND){
+      settle_last = time;
+    }
+    if (step_size > 0 && -_error > overshoot){
+      overshoot = -_error;
+    }
+    else if (step_size < 0 && _error > overshoot){
+      overshoot = _error;
+    }
+  }
+}
+
+// ---------------------------------
+// Method for reporting a field pass
+// ---------------------------------
+void SimField::report(){
+  closeStep();
+
+  last.settle = settle_max;
+  last.overshoot = int(overshoot_max);
+  last.rms = 0;
+  last.effort = 0;
+
+  if (samples){
+    last.rms = int(sqrt(sum_sq / samples) * 100);
+    last.effort = effort_sum * 100 / (255 * samples);
+  }
+
+  if (quiet){
+    return;
+  }
+
+  Serial.println(S_DIVIDE);
+  Serial.print("SIM distance m: ");
+  Serial.println(distance / 100);
+  Serial.print("SIM settle ms: ");
+  Serial.println(last.settle);
+  Serial.print("SIM overshoot %: ");
+  Serial.println(last.overshoot);
+  Serial.print("SIM rms xte mm: ");
+  Serial.println(last.rms / 10.0);
+  Serial.print("SIM valve duty %: ");
+  Serial.println(last.effort);
+}
+
+// -----------
+// Constructor
+// -----------
+ImplementPloughSim::ImplementPloughSim(SimField * _field){
+  field = _field;
+
+  mode = 2;  // MANUAL
+  offset = 0;
+  command = 0;
+
+  // Defaults
+  shares = 5;
+  kp = 100;
+  pwm_man = 200;
+  pwm_auto = 150;
+  error = 2;
+  max_correction = 30;
+  side = true;
+
+  commitCalibration();
+}
+
+// ----------------------------------
+// Method for updating control (AUTO)
+// ----------------------------------
+void ImplementPloughSim::update(byte _mode, int _buttons){
+  update(_mode, _buttons, field->getXte());
+}
+
+void ImplementPloughSim::update(byte _mode, int _buttons, int _xte){
+  int _error;
+
+  mode = _mode;
+  field->automatic = (mode == 0);
+  field->shares = shares;
+
+  switch (mode){
+  case 0: // AUTO
+    offset = constrain(long(_xte) * kp / 100,
+                       -max_correction, max_correction);
+    _error = offset - field->getPosition();
+
+    if (_error > error){
+      command = pwm_auto;
+    }
+    else if (_error < -error){
+      command = -pwm_auto;
+    }
+    else {
+      command = 0;
+    }
+    break;
+  case 1: // HOLD
+    command = 0;
+    break;
+  default: // MANUAL
+    offset = field->getPosition();
+    command = 0;
+    break;
+  }
+}
+
+// ----------------------------
+// Method for driving the valve
+// ----------------------------
+void ImplementPloughSim::adjust(int _buttons){
+  if (_buttons == 1 || _buttons == -1){
+    field->drive = _buttons * pwm_man;
+  }
+  else {
+    field->drive = command;
+  }
+}
+
+// -----------------------------
+// Method for stopping the valve
+// -----------------------------
+void ImplementPloughSim::stop(){
+  command = 0;
+  field->drive = 0;
+  field->automatic = false;
+}
+
+// ----------------------------
+// Methods for calibration data
+// ----------------------------
+int ImplementPloughSim::getPositionCalibrationPoint(int _i){
+  return (_i - 1) * 30;
+}
+
+void ImplementPloughSim::resetCalibration(){
+  shares = shares_c;
+  kp = kp_c;
+  pwm_man = pwm_man_c;
+  pwm_auto = pwm_auto_c;
+  error = error_c;
+  max_correction = max_correction_c;
+  side = side_c;
+}
+
+void ImplementPloughSim::commitCalibration(){
+  shares_c = shares;
+  kp_c = kp;
+  pwm_man_c = pwm_man;
+  pwm_auto_c = pwm_auto;
+  error_c = error;
+  max_correction_c = max_correction;
+  side_c = side;
+}
+
+#endif
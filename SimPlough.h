@@ -0,0 +1,383 @@
+/*
+  SimPlough - closed loop plough/tractor simulator for the MeijWorks interface
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SimPlough_h
+#define SimPlough_h
+
+#include "Arduino.h"
+#include "ConfigInterfacePlough.h"
+
+#ifdef SIM
+
+// Simulation step and GPS epoch (ms of simulated time)
+#define SIM_STEP          20
+#define SIM_GPS_EPOCH     100
+#define SIM_GPS_NOISE     2       // cm peak jitter on reported XTE
+
+// Hydraulic model
+#define SIM_RATE          12.0    // cm/s at full PWM
+#define SIM_DEADBAND      60      // PWM below which the valve does not open
+#define SIM_VALVE_TAU     150.0   // ms valve/cylinder lag
+#define SIM_STROKE        60.0    // cm stroke either side of neutral
+#define SIM_ROT_PER_CM    0.5     // deg rotation per cm width
+#define SIM_ROT_TAU       300.0   // ms rotation lag
+
+// Host builds run one field per thread, each with its own simulated time
+#ifdef __AVR__
+#define SIM_LOCAL
+#else
+#define SIM_LOCAL         thread_local
+#endif
+
+// Scoring
+#define SIM_SETTLE_BAND   2.0     // cm band for settling time
+#define SIM_MIN_SPEED     20      // 0.1 km/h below which the GPS reports no speed
+
+// Score of a completed field pass
+struct SimScore {
+  unsigned int rms;       // 0.1 mm RMS tracking error
+  unsigned int overshoot; // % of step
+  unsigned long settle;   // ms worst settling time
+  byte effort;            // % mean valve duty
+};
+
+// Segment of a scripted field pass
+struct SimSegment {
+  unsigned int duration;  // ms
+  int speed;              // 0.1 km/h
+  int xte;                // cm lateral offset of the tractor from the AB line
+  int amplitude;          // cm sway on top of xte
+  int period;             // 0.1 s period of sway
+};
+
+// -------------------------------------------------
+// Shared simulated world: tractor, plough and GPS
+// -------------------------------------------------
+class SimField {
+private:
+  //-------------
+  // data members
+  //-------------
+
+  // Script
+  const SimSegment * script;
+  byte segments;
+  byte segment;
+  unsigned long segment_start;
+
+  // Time (ms of simulated time) and real time it has caught up with
+  unsigned long time;
+  unsigned long clock;
+
+  // Field providing simMillis(), and the one it replaced
+  static SIM_LOCAL SimField * active;
+  SimField * previous;
+
+  // Tractor
+  float speed;      // cm/s
+  float xte;        // cm
+  float distance;   // cm along AB line
+
+  // Plough
+  float position;   // cm
+  float rate;       // cm/s
+  float rotation;   // deg
+
+  // GPS
+  int gps_xte;
+  unsigned long gps_fix;
+  unsigned long gps_seed;
+
+  // Score
+  float step_size;
+  float overshoot;
+  unsigned long settle_start;
+  unsigned long settle_last;
+  unsigned long settle_max;
+  float overshoot_max;
+  float sum_sq;
+  unsigned long samples;
+  unsigned long effort_sum;
+  SimScore last;
+  unsigned int passes;
+
+  // -------------------------------------------
+  // private member functions
+  // -------------------------------------------
+  void advance();
+  void closeStep();
+  void loadSegment();
+  int noise();
+  void score(float _error);
+  void report();
+public:
+  // Valve command (-255 .. 255), written by the implement
+  int drive;
+
+  // Implement is controlling automatically
+  boolean automatic;
+
+  // Number of shares, written by the implement (cylinder load)
+  byte shares;
+
+  // Suppress the Serial report at the end of a pass
+  boolean quiet;
+
+  // Follow millis() instead of one step per call
+  boolean realtime;
+
+  // ----------------------------------------------------
+  // public member functions implemented in SimPlough.cpp
+  // ----------------------------------------------------
+
+  // Constructor and destructor
+  SimField(const SimSegment * _script, byte _segments);
+  ~SimField();
+
+  static unsigned long now();
+
+  void reset();
+  void step();
+
+  inline int getPosition(){
+    return int(position);
+  };
+  inline int getRotation(){
+    return int(rotation);
+  };
+  inline int getXte(){
+    return gps_xte;
+  };
+  inline unsigned long getFix(){
+    return gps_fix;
+  };
+  inline int getSpeed(){
+    return int(speed * 0.36);
+  };
+  inline unsigned long getTime(){
+    return time;
+  };
+  inline unsigned int getPasses(){
+    return passes;
+  };
+  inline const SimScore & getScore(){
+    return last;
+  };
+};
+
+// -------------------------------------------------
+// Stand-in for ImplementPlough
+// -------------------------------------------------
+class ImplementPloughSim {
+private:
+  //-------------
+  // data members
+  //-------------
+  SimField * field;
+
+  byte mode;
+  int offset;
+  int command;
+  boolean side;
+
+  // Calibration data (working and committed)
+  int shares, shares_c;
+  int kp, kp_c;
+  byte pwm_man, pwm_man_c;
+  byte pwm_auto, pwm_auto_c;
+  byte error, error_c;
+  int max_correction, max_correction_c;
+  boolean side_c;
+public:
+  // Constructor
+  ImplementPloughSim(SimField * _field);
+
+  void update(byte _mode, int _buttons);
+  void update(byte _mode, int _buttons, int _xte);
+  void adjust(int _buttons);
+  void stop();
+
+  void resetCalibration();
+  void commitCalibration();
+
+  // Calibration points
+  int getPositionCalibrationPoint(int _i);
+  inline void setPositionCalibrationData(int _i){
+  };
+  inline int getRotationCalibrationPoint(int _i){
+    return getPositionCalibrationPoint(_i);
+  };
+  inline void setRotationCalibrationData(int _i){
+  };
+
+  // Getters
+  inline int getOffset(){
+    return offset;
+  };
+  inline int getPosition(){
+    return field->getPosition();
+  };
+  inline int getRotation(){
+    return field->getRotation();
+  };
+  inline boolean getSide(){
+    return side;
+  };
+  inline int getShares(){
+    return shares;
+  };
+  inline int getKP(){
+    return kp;
+  };
+  inline byte getPwmMan(){
+    return pwm_man;
+  };
+  inline byte getPwmAuto(){
+    return pwm_auto;
+  };
+  inline byte getError(){
+    return error;
+  };
+  inline int getMaxCorrection(){
+    return max_correction;
+  };
+
+  // Setters
+  inline void setShares(int _shares){
+    shares = _shares;
+  };
+  inline void setKP(int _kp){
+    kp = _kp;
+  };
+  inline void setPwmMan(byte _pwm){
+    pwm_man = _pwm;
+  };
+  inline void setPwmAuto(byte _pwm){
+    pwm_auto = _pwm;
+  };
+  inline void setError(byte _error){
+    error = _error;
+  };
+  inline void setMaxCorrection(int _max){
+    max_correction = _max;
+  };
+  inline void setSwap(boolean _side){
+    side = _side;
+  };
+};
+
+// -------------------------------------------------
+// Stand-in for VehicleGps
+// -------------------------------------------------
+class VehicleGpsSim {
+private:
+  SimField * field;
+public:
+  inline VehicleGpsSim(SimField * _field){
+    field = _field;
+  };
+
+  inline void update(){
+    field->step();
+  };
+  inline int getXte(){
+    return field->getXte();
+  };
+  inline unsigned long getGgaFixAge(){
+    return field->getFix();
+  };
+  inline unsigned long getVtgFixAge(){
+    return field->getFix();
+  };
+  inline unsigned long getXteFixAge(){
+    return field->getFix();
+  };
+  inline byte getQuality(){
+    return 4;
+  };
+  inline boolean minSpeed(){
+    return field->getSpeed() >= SIM_MIN_SPEED;
+  };
+};
+
+// -------------------------------------------------
+// Stand-in for VehicleTractor
+// -------------------------------------------------
+class VehicleTractorSim {
+private:
+  boolean deutz;
+public:
+  inline VehicleTractorSim(SimField * _field){
+    deutz = false;
+  };
+
+  inline void update(){
+  };
+  inline boolean getHitch(){
+    return false;
+  };
+  inline void resetWheelspeedPulses(){
+  };
+  inline int calibrateSpeed(int _buttons){
+    return 0;
+  };
+  inline boolean getDeutz(){
+    return deutz;
+  };
+  inline void enableDeutz(){
+    deutz = true;
+  };
+  inline void disableDeutz(){
+    deutz = false;
+  };
+  inline void resetCalibration(){
+  };
+  inline void commitCalibration(){
+  };
+};
+
+// The stand-ins have the optional methods of the libraries, and the
+// implement takes the XTE from the interface as well. With SIM_OPTIONS the
+// build defines which of KP, PWM_MAN, PWM_AUTO and SPEED_L the libraries
+// have, as extras/linux/combos.sh does per variant.
+#ifndef SIM_OPTIONS
+#define KP
+#define PWM_MAN
+#define PWM_AUTO
+#define SPEED_L
+#endif
+#define IMPLEMENT_XTE
+
+// In SIM mode the interface runs unchanged on the stand-ins, on simulated time
+#define millis() SimField::now()
+
+typedef ImplementPloughSim ImplementPlough;
+typedef VehicleTractorSim VehicleTractor;
+
+// With NMEA_STREAM the simulated plough runs on real NMEA input
+#ifndef NMEA_STREAM
+typedef VehicleGpsSim VehicleGps;
+#endif
+
+// Default scripted field pass
+extern const SimSegment SIM_PASS[];
+extern const byte SIM_PASS_SEGMENTS;
+
+#endif
+#endif
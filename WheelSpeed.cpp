@@ -0,0 +1,233 @@
+/*
+  WheelSpeed - wheel speed from Timer1 input capture
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WheelSpeed.h"
+
+#ifdef WHEEL_SPEED
+#include <avr/interrupt.h>
+#include <avr/eeprom.h>
+
+// Longest period still counted as moving, in timer ticks
+#define WHEEL_TIMEOUT_TICKS ((unsigned long)WHEEL_TIMEOUT * (WHEEL_CLOCK / 1000))
+
+WheelSpeed wheel_speed;
+
+// -----------
+// Constructor
+// -----------
+WheelSpeed::WheelSpeed(){
+  overflows = 0;
+
+  for (byte i = 0; i < WHEEL_WINDOW; i++){
+    periods[i] = 0;
+  }
+  sum = 0;
+  count = 0;
+  head = 0;
+
+  last = 0;
+  pulses = 0;
+  timing = false;
+
+  setPulses(WHEEL_PULSES);
+}
+
+// --------------------------------------------------------------
+// Method for starting Timer1: normal mode, prescaler 64, capture
+// on the rising edge with the noise canceler (4 equal samples)
+// --------------------------------------------------------------
+void WheelSpeed::begin(){
+  uint8_t _sreg = SREG;
+
+  cli();
+
+  pinMode(WHEEL_PIN, INPUT);
+
+  TCCR1A = 0;
+  TCCR1B = (1 << ICNC1) | (1 << ICES1) | (1 << CS11) | (1 << CS10);
+  TCNT1 = 0;
+  TIFR1 = (1 << ICF1) | (1 << TOV1);
+  TIMSK1 = (1 << ICIE1) | (1 << TOIE1);
+
+  SREG = _sreg;
+
+  // Calibrated pulses per 100 m
+  resetCalibration();
+}
+
+// ------------------------------------------------------------------
+// Method for handling a captured edge (interrupt). An overflow still
+// pending with a small capture value happened before the edge.
+// ------------------------------------------------------------------
+void WheelSpeed::capture(unsigned int _capture, boolean _overflow){
+  unsigned long _time;
+  unsigned long _period;
+  unsigned int _overflows = overflows;
+
+  if (_overflow && _capture < 0x8000){
+    _overflows++;
+  }
+  _time = ((unsigned long)_overflows << 16) | _capture;
+  _period = _time - last;
+  last = _time;
+  pulses++;
+
+  // First pulse, or the first after standing still, only starts timing
+  if (!timing || _period > WHEEL_TIMEOUT_TICKS){
+    timing = true;
+    sum = 0;
+    count = 0;
+    return;
+  }
+
+  // Moving window, the oldest period drops out
+  if (count == WHEEL_WINDOW){
+    sum -= periods[head];
+  }
+  else {
+    count++;
+  }
+  periods[head] = _period;
+  sum += _period;
+  if (++head == WHEEL_WINDOW){
+    head = 0;
+  }
+}
+
+// ---------------------------------------
+// Method for a timer overflow (interrupt)
+// ---------------------------------------
+void WheelSpeed::overflow(){
+  overflows++;
+}
+
+// ------------------------------------------
+// Method for the current time in timer ticks
+// ------------------------------------------
+unsigned long WheelSpeed::now(){
+  unsigned int _count = TCNT1;
+  unsigned int _overflows = overflows;
+
+  if ((TIFR1 & (1 << TOV1)) && _count < 0x8000){
+    _overflows++;
+  }
+  return ((unsigned long)_overflows << 16) | _count;
+}
+
+// -------------------------------------------------------------------
+// Method for the speed in 0.1 km/h. While the wheel slows down the
+// time since the last pulse is longer than the mean period and gives
+// the speed instead, so it falls to 0 without waiting for a pulse.
+// After WHEEL_TIMEOUT the periods are dropped and the next pulse only
+// starts timing, so standing still stays 0 also once the time since
+// the last pulse wraps (2^32 ticks, 4.77 h).
+// -------------------------------------------------------------------
+unsigned int WheelSpeed::getSpeed(){
+  unsigned long _sum;
+  unsigned long _elapsed;
+  byte _count;
+  uint8_t _sreg = SREG;
+
+  cli();
+  _elapsed = now() - last;
+  if (_elapsed > WHEEL_TIMEOUT_TICKS){
+    timing = false;
+    count = 0;
+  }
+  _sum = sum;
+  _count = count;
+  SREG = _sreg;
+
+  if (!_count){
+    return 0;
+  }
+
+  if (_elapsed * _count > _sum){
+    return scale / _elapsed;
+  }
+  return scale / (_sum / _count);
+}
+
+// -----------------------------------------------
+// Method for the pulses since start or last reset
+// -----------------------------------------------
+unsigned long WheelSpeed::getPulses(){
+  unsigned long _pulses;
+  uint8_t _sreg = SREG;
+
+  cli();
+  _pulses = pulses;
+  SREG = _sreg;
+
+  return _pulses;
+}
+
+// -----------------------------------
+// Method for setting pulses per 100 m
+// -----------------------------------
+void WheelSpeed::setPulses(unsigned int _pulses){
+  calibration = max(_pulses, 1U);
+
+  // 0.1 km/h = pulses/s * 100 m / _pulses * 3.6 * 10
+  scale = WHEEL_CLOCK * 3600UL / calibration;
+}
+
+// ----------------------------------------
+// Method for restarting the pulses counted
+// ----------------------------------------
+void WheelSpeed::resetPulses(){
+  uint8_t _sreg = SREG;
+
+  cli();
+  pulses = 0;
+  SREG = _sreg;
+}
+
+// -------------------------------------------------------------
+// Method for reading pulses per 100 m from EEPROM, WHEEL_PULSES
+// while it was never stored (erased)
+// -------------------------------------------------------------
+void WheelSpeed::resetCalibration(){
+  unsigned int _pulses = eeprom_read_word((uint16_t *)WHEEL_EEPROM);
+
+  if (_pulses == 0 || _pulses == 0xFFFF){
+    _pulses = WHEEL_PULSES;
+  }
+  setPulses(_pulses);
+}
+
+// ---------------------------------------------
+// Method for storing pulses per 100 m in EEPROM
+// ---------------------------------------------
+void WheelSpeed::commitCalibration(){
+  eeprom_update_word((uint16_t *)WHEEL_EEPROM, calibration);
+}
+
+// ---------------
+// Timer1 captures
+// ---------------
+ISR(TIMER1_CAPT_vect){
+  wheel_speed.capture(ICR1, TIFR1 & (1 << TOV1));
+}
+
+ISR(TIMER1_OVF_vect){
+  wheel_speed.overflow();
+}
+
+#endif
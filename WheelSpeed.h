@@ -0,0 +1,90 @@
+/*
+  WheelSpeed - wheel speed from Timer1 input capture
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WheelSpeed_h
+#define WheelSpeed_h
+
+#include "Arduino.h"
+#include "ConfigInterfacePlough.h"
+
+// Timer1 ticks per second, prescaler 64
+#define WHEEL_CLOCK       (F_CPU / 64)
+
+// Input capture pin of Timer1 (ICP1), fixed by the hardware
+#define WHEEL_PIN         8
+
+// Times every wheel pulse on ICP1 (pin 8) with Timer1 input capture. The
+// timer runs at 4 us (16 MHz), overflows extend it to 32 bits. The capture
+// interrupt keeps the last WHEEL_WINDOW periods and their sum, so a speed
+// is one division and no pulses are counted in software.
+//
+// Timer1 runs in normal mode, analogWrite() on pins 9 and 10 stops working.
+class WheelSpeed {
+private:
+  //-------------
+  // data members
+  //-------------
+  // Timer extension
+  volatile unsigned int overflows;
+
+  // Periods of the last pulses, in timer ticks
+  unsigned long periods[WHEEL_WINDOW];
+  volatile unsigned long sum;
+  volatile byte count;
+  byte head;
+
+  volatile unsigned long last;
+  volatile unsigned long pulses;
+  volatile boolean timing;
+
+  // Pulses per 100 m, 0.1 km/h times ticks per pulse
+  unsigned int calibration;
+  unsigned long scale;
+
+  //-----------------------------------
+  // private member functions
+  //-----------------------------------
+  unsigned long now();
+public:
+  // Constructor
+  WheelSpeed();
+
+  void begin();
+  void capture(unsigned int _capture, boolean _overflow);
+  void overflow();
+
+  // Getters
+  unsigned int getSpeed();
+  unsigned long getPulses();
+  inline boolean minSpeed(){
+    return getSpeed() >= WHEEL_MIN_SPEED;
+  };
+
+  // Setters
+  void setPulses(unsigned int _pulses);
+  void resetPulses();
+
+  // Pulses per 100 m in EEPROM (WHEEL_EEPROM)
+  void resetCalibration();
+  void commitCalibration();
+};
+
+extern WheelSpeed wheel_speed;
+
+#endif
@@ -0,0 +1,170 @@
+#!/bin/sh
+#
+#  footprint.sh - flash and RAM footprint of InterfacePlough per feature set
+# Copyright (C) 2011-2015 J.A. Woltjer.
+# All rights reserved.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Compiles the library for the AVR target once per line of combinations.txt
+# and writes a CSV report of section and per-function sizes, with deltas
+# against a stored baseline:
+#
+#   variant,item,bytes,baseline,delta
+#
+# Items are flash, data, bss and strings (.rodata, which avr-ld places in
+# RAM) of the library objects, and the flash size of the main member
+# functions. Flash is what avr-size counts as program: code (.text),
+# PROGMEM tables and texts (.progmem), and the initial values of data and
+# strings, which are copied from flash at startup. Sizes are per object,
+# before linking, so they do not include the Arduino core or the
+# implement and vehicle libraries.
+#
+# The baseline is measured with footprint.sh -u. Without one, only its
+# header, the script stops before compiling; a variant or item missing
+# from it is reported and gets empty baseline and delta columns.
+#
+# usage: footprint.sh [-o report.csv] [-b baseline.csv] [-u] [-t bytes]
+#
+#   -o  report file (default footprint.csv)
+#   -b  baseline file (default baseline.csv next to this script)
+#   -u  store this report as the new baseline
+#   -t  fail when flash of a variant grows more than this many bytes
+#
+# Environment:
+#   ARDUINO_DIR  Arduino IDE installation (default /usr/share/arduino)
+#   LIBRARIES    sketchbook libraries with ImplementPlough, VehicleGps,
+#                VehicleTractor and LiquidCrystal_I2C (default
+#                ~/Arduino/libraries)
+#   MCU          default atmega328p
+#   F_CPU        default 16000000L
+#   CROSS        toolchain prefix (default avr-)
+
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+LIBRARY=$(cd "$HERE/../.." && pwd)
+
+ARDUINO_DIR=${ARDUINO_DIR:-/usr/share/arduino}
+LIBRARIES=${LIBRARIES:-$HOME/Arduino/libraries}
+MCU=${MCU:-atmega328p}
+F_CPU=${F_CPU:-16000000L}
+CROSS=${CROSS:-avr-}
+
+REPORT=footprint.csv
+BASELINE=$HERE/baseline.csv
+UPDATE=0
+THRESHOLD=
+
+while getopts "o:b:ut:" OPT; do
+  case $OPT in
+    o) REPORT=$OPTARG ;;
+    b) BASELINE=$OPTARG ;;
+    u) UPDATE=1 ;;
+    t) THRESHOLD=$OPTARG ;;
+    *) sed -n '/^# usage/,/^#   -t/s/^# \{0,1\}//p' "$0"; exit 2 ;;
+  esac
+done
+
+# Member functions reported separately
+FUNCTIONS="update updateScreen calibrate checkButtons control autotune"
+
+CXXFLAGS="-c -g -Os -std=gnu++11 -fno-exceptions -fno-threadsafe-statics \
+  -ffunction-sections -fdata-sections -mmcu=$MCU -DF_CPU=$F_CPU \
+  -DARDUINO=10605 -DARDUINO_ARCH_AVR"
+
+INCLUDES="-I$ARDUINO_DIR/hardware/arduino/avr/cores/arduino \
+  -I$ARDUINO_DIR/hardware/arduino/avr/variants/standard"
+for DIR in "$LIBRARIES"/*; do
+  [ -d "$DIR/src" ] && INCLUDES="$INCLUDES -I$DIR/src"
+  [ -d "$DIR" ] && INCLUDES="$INCLUDES -I$DIR"
+done
+
+# Deltas need a measured baseline
+if [ $UPDATE -eq 0 ] && [ "$(grep -c , "$BASELINE" 2>/dev/null)" -lt 2 ]; then
+  echo "footprint: no baseline in $BASELINE, store one with -u" >&2
+  exit 1
+fi
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+. "$HERE/variant.sh"
+
+# ---------------------------------------------
+# Sum of sections matching a pattern in objects
+# ---------------------------------------------
+sections() {
+  ${CROSS}size -A "$@" | awk -v re="$PATTERN" '$1 ~ re { n += $2 } END { print n + 0 }'
+}
+
+# ------------------------------------------
+# Flash size of all symbols of one function
+# ------------------------------------------
+function_size() {
+  ${CROSS}nm -C -S --size-sort -t d "$@" |
+    awk -v f="InterfacePlough<PloughFeatures>::$FUNCTION(" '
+      index($0, f) && $3 ~ /^[TtWw]$/ { n += $2 }
+      END { print n + 0 }'
+}
+
+: > "$WORK/report.csv"
+
+grep -v '^[[:space:]]*\(#\|$\)' "$HERE/combinations.txt" |
+while read VARIANT FLAGS; do
+  SRC=$WORK/$VARIANT
+  variant "$SRC" $FLAGS
+
+  OBJECTS=
+  for FILE in "$SRC"/*.cpp; do
+    ${CROSS}g++ $CXXFLAGS $DEFINES -I"$SRC" $INCLUDES "$FILE" -o "$FILE.o"
+    OBJECTS="$OBJECTS $FILE.o"
+  done
+
+  PATTERN='^\.(text|progmem|data|rodata)'
+  echo "$VARIANT,flash,$(sections $OBJECTS)" >> "$WORK/report.csv"
+  PATTERN='^\.data'
+  echo "$VARIANT,data,$(sections $OBJECTS)" >> "$WORK/report.csv"
+  PATTERN='^\.bss'
+  echo "$VARIANT,bss,$(sections $OBJECTS)" >> "$WORK/report.csv"
+  PATTERN='^\.rodata'
+  echo "$VARIANT,strings,$(sections $OBJECTS)" >> "$WORK/report.csv"
+
+  for FUNCTION in $FUNCTIONS; do
+    echo "$VARIANT,$FUNCTION,$(function_size $OBJECTS)" >> "$WORK/report.csv"
+  done
+done
+
+# Add baseline and delta columns
+touch "$WORK/baseline.csv"
+[ -f "$BASELINE" ] && cp "$BASELINE" "$WORK/baseline.csv"
+
+awk -F, -v OFS=, '
+  FILENAME == ARGV[1] { if (FNR > 1) base[$1 "," $2] = $3; next }
+  !header++ { print "variant,item,bytes,baseline,delta" }
+  {
+    key = $1 "," $2
+    if (key in base) print $1, $2, $3, base[key], $3 - base[key]
+    else {
+      print "footprint: no baseline for " key > "/dev/stderr"
+      print $1, $2, $3, "", ""
+    }
+  }' "$WORK/baseline.csv" "$WORK/report.csv" > "$REPORT"
+
+echo "footprint: $(grep -c ',flash,' "$REPORT") variants written to $REPORT"
+
+if [ $UPDATE -eq 1 ]; then
+  cut -d, -f1-3 "$REPORT" > "$BASELINE"
+  echo "footprint: baseline stored in $BASELINE"
+fi
+
+if [ -n "$THRESHOLD" ]; then
+  awk -F, -v t="$THRESHOLD" '
+    $2 == "flash" && $5 != "" && $5 > t {
+      print "footprint: " $1 " flash grew " $5 " bytes"; failed = 1
+    }
+    END { exit failed }' "$REPORT"
+fi
@@ -0,0 +1,52 @@
+#
+#  variant.sh - library sources of one line of combinations.txt
+# Copyright (C) 2011-2015 J.A. Woltjer.
+# All rights reserved.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Sourced by footprint.sh and extras/linux/combos.sh. variant DIR FLAGS...
+# copies the library in $LIBRARY to DIR and applies the flags to its
+# ConfigInterfacePlough.h. Flags that are not in the configuration are
+# left in DEFINES as -D/-U for the compiler.
+
+# ---------------------------------------------
+# Library sources of one variant in a directory
+# ---------------------------------------------
+variant() {
+  SRC=$1
+  shift
+  mkdir -p "$SRC"
+  cp "$LIBRARY"/*.h "$LIBRARY"/*.cpp "$SRC"
+  [ -f "$SRC/Language.h" ] || cp "$SRC/language.h" "$SRC/Language.h"
+
+  # +FLAG switches a feature on, -FLAG off. Flags not in the configuration
+  # (e.g. KP, PWM_MAN, PWM_AUTO, SPEED_L) are passed on the command line.
+  DEFINES=
+  for FLAG in "$@"; do
+    # NAME=VALUE sets a value of the configuration
+    case $FLAG in
+      *=*)
+        NAME=${FLAG%%=*}
+        sed -i "s|^\(#define $NAME \{1,\}\)[^ ]*|\1${FLAG#*=}|" \
+          "$SRC/ConfigInterfacePlough.h"
+        continue ;;
+    esac
+
+    NAME=${FLAG#[+-]}
+    if grep -q "^\(//\)\{0,1\}#define $NAME\b" "$SRC/ConfigInterfacePlough.h"; then
+      case $FLAG in
+        -*) sed -i "s|^#define $NAME\b|//#define $NAME|" "$SRC/ConfigInterfacePlough.h" ;;
+        *)  sed -i "s|^//#define $NAME\b|#define $NAME|" "$SRC/ConfigInterfacePlough.h" ;;
+      esac
+    else
+      case $FLAG in
+        -*) DEFINES="$DEFINES -U$NAME" ;;
+        *)  DEFINES="$DEFINES -D$NAME" ;;
+      esac
+    fi
+  done
+}
@@ -0,0 +1,153 @@
+/*
+  Arduino.cpp - minimal Arduino core for running the interface on Linux
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <time.h>
+
+#include "Arduino.h"
+
+thread_local byte arduino_pins[ARDUINO_PINS];
+void (*arduino_poll)(int _timeout) = 0;
+unsigned long (*arduino_clock)() = 0;
+
+HardwareSerial Serial;
+
+// ------------------------------------------
+// Method for reading the monotonic clock (us)
+// ------------------------------------------
+static unsigned long long monotonic(){
+  static unsigned long long _start = 0;
+  struct timespec _ts;
+  unsigned long long _now;
+
+  clock_gettime(CLOCK_MONOTONIC, &_ts);
+  _now = _ts.tv_sec * 1000000ULL + _ts.tv_nsec / 1000;
+
+  if (!_start){
+    _start = _now;
+  }
+  return _now - _start;
+}
+
+unsigned long millis(){
+  if (arduino_clock){
+    return arduino_clock();
+  }
+  return (unsigned long)(monotonic() / 1000);
+}
+
+unsigned long micros(){
+  return (unsigned long)monotonic();
+}
+
+// ---------------------------------------
+// Method for waiting while pumping events
+// ---------------------------------------
+void delay(unsigned long _ms){
+  unsigned long _start = millis();
+  unsigned long _elapsed;
+  struct timespec _ts;
+
+  while ((_elapsed = millis() - _start) < _ms){
+    if (arduino_poll){
+      arduino_poll(int(_ms - _elapsed));
+    }
+    else {
+      _ts.tv_sec = (_ms - _elapsed) / 1000;
+      _ts.tv_nsec = (_ms - _elapsed) % 1000 * 1000000L;
+      nanosleep(&_ts, 0);
+    }
+  }
+}
+
+// ----------------------
+// Methods for digital IO
+// ----------------------
+void pinMode(byte _pin, byte _mode){
+}
+
+void digitalWrite(byte _pin, byte _value){
+  if (_pin < ARDUINO_PINS){
+    arduino_pins[_pin] = _value;
+  }
+}
+
+int digitalRead(byte _pin){
+  if (arduino_poll){
+    arduino_poll(0);
+  }
+  return _pin < ARDUINO_PINS ? arduino_pins[_pin] : LOW;
+}
+
+long random(long _max){
+  return _max > 0 ? rand() % _max : 0;
+}
+
+long random(long _min, long _max){
+  return _min + random(_max - _min);
+}
+
+// -------------------
+// Methods for Print
+// -------------------
+void Print::print(const char * _s){
+  fputs(_s, file);
+}
+
+void Print::print(char _c){
+  fputc(_c, file);
+}
+
+void Print::print(unsigned char _v, int _base){
+  print((unsigned long)_v, _base);
+}
+
+void Print::print(int _v, int _base){
+  print((long)_v, _base);
+}
+
+void Print::print(unsigned int _v, int _base){
+  print((unsigned long)_v, _base);
+}
+
+void Print::print(long _v, int _base){
+  if (_base == 16){
+    fprintf(file, "%lX", _v);
+  }
+  else {
+    fprintf(file, "%ld", _v);
+  }
+}
+
+void Print::print(unsigned long _v, int _base){
+  if (_base == 16){
+    fprintf(file, "%lX", _v);
+  }
+  else {
+    fprintf(file, "%lu", _v);
+  }
+}
+
+void Print::print(double _v, int _digits){
+  fprintf(file, "%.*f", _digits, _v);
+}
+
+void Print::println(){
+  fputc('\n', file);
+  fflush(file);
+}
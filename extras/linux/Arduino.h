@@ -0,0 +1,139 @@
+/*
+  Arduino.h - minimal Arduino core for running the interface on Linux
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define LOW               0
+#define HIGH              1
+#define INPUT             0
+#define OUTPUT            1
+#define INPUT_PULLUP      2
+
+#define PI                3.1415926535897932384626433832795
+
+// Only used to convert profile times to cycles
+#define F_CPU             16000000L
+
+// Flash is ordinary memory
+#define PROGMEM
+#define pgm_read_byte(p)  ((uint8_t)*(p))
+#define pgm_read_word(p)  ((uint16_t)*(p))
+#define F(s)              (s)
+
+#ifndef min
+#define min(a, b)         ((a) < (b) ? (a) : (b))
+#define max(a, b)         ((a) > (b) ? (a) : (b))
+#endif
+#define constrain(a, l, h) ((a) < (l) ? (l) : ((a) > (h) ? (h) : (a)))
+
+// Digital pins backed by memory, written by the input device. One set per
+// thread, so every simulated instance of simsweep has its own inputs.
+#define ARDUINO_PINS      20
+extern thread_local byte arduino_pins[ARDUINO_PINS];
+
+// Event pump, run whenever library code polls a pin or waits, so blocking
+// loops such as calibrate() keep receiving input (timeout in ms, -1 blocks)
+extern void (*arduino_poll)(int _timeout);
+
+// Clock read by millis() instead of the monotonic clock when set, for tests
+// that step time themselves (ms)
+extern unsigned long (*arduino_clock)();
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long _ms);
+
+void pinMode(byte _pin, byte _mode);
+void digitalWrite(byte _pin, byte _value);
+int digitalRead(byte _pin);
+
+long random(long _max);
+long random(long _min, long _max);
+
+// -------------------------------------------------
+// Print, writing to a stdio stream
+// -------------------------------------------------
+class Print {
+protected:
+  FILE * file;
+public:
+  inline Print(){
+    file = stderr;
+  };
+  inline void setFile(FILE * _file){
+    file = _file;
+  };
+
+  void print(const char * _s);
+  void print(char _c);
+  void print(unsigned char _v, int _base = 10);
+  void print(int _v, int _base = 10);
+  void print(unsigned int _v, int _base = 10);
+  void print(long _v, int _base = 10);
+  void print(unsigned long _v, int _base = 10);
+  void print(double _v, int _digits = 2);
+
+  void println();
+  template <typename T> inline void println(T _v){
+    print(_v);
+    println();
+  };
+  template <typename T> inline void println(T _v, int _format){
+    print(_v, _format);
+    println();
+  };
+};
+
+// -------------------------------------------------
+// Stream, a Print that can be read from
+// -------------------------------------------------
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+};
+
+// -------------------------------------------------
+// Serial, telemetry and debug output only
+// -------------------------------------------------
+class HardwareSerial : public Stream {
+public:
+  inline void begin(long _baud){
+  };
+  inline int available(){
+    return 0;
+  };
+  inline int read(){
+    return -1;
+  };
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,103 @@
+/*
+  LiquidCrystal_I2C.cpp - 20x4 screen buffer rendered to a terminal or file
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+
+#include "LiquidCrystal_I2C.h"
+
+// -----------
+// Constructor
+// -----------
+LiquidCrystal_I2C::LiquidCrystal_I2C(){
+  for (byte i = 0; i < LCD_ROWS; i++){
+    memset(buffer[i], ' ', LCD_COLUMNS);
+    buffer[i][LCD_COLUMNS] = 0;
+  }
+  changed = true;
+
+  terminal = 0;
+  path = 0;
+}
+
+// ----------------------------
+// Methods for writing buffer
+// ----------------------------
+void LiquidCrystal_I2C::write_buffer(const char * _text, int _row){
+  if (_row < 0 || _row >= LCD_ROWS){
+    return;
+  }
+
+  for (byte i = 0; i < LCD_COLUMNS && _text[i]; i++){
+    buffer[_row][i] = _text[i];
+  }
+  changed = true;
+}
+
+void LiquidCrystal_I2C::write_buffer(char _c, int _row, int _column){
+  if (_row < 0 || _row >= LCD_ROWS || _column < 0 || _column >= LCD_COLUMNS){
+    return;
+  }
+
+  buffer[_row][_column] = _c;
+  changed = true;
+}
+
+// ------------------------------------------------------------------
+// Method for writing screen, rendering is left to render() so output
+// is paced by the daemon instead of by every call
+// ------------------------------------------------------------------
+void LiquidCrystal_I2C::write_screen(int _count){
+}
+
+// ---------------------------------------
+// Method for rendering a changed buffer
+// ---------------------------------------
+void LiquidCrystal_I2C::render(){
+  FILE * _file;
+  char _temp[256];
+
+  if (!changed){
+    return;
+  }
+  changed = false;
+
+  if (terminal){
+    // Home, then overwrite the four lines in place
+    fputs("\033[H", terminal);
+    fputs("+--------------------+\n", terminal);
+    for (byte i = 0; i < LCD_ROWS; i++){
+      fprintf(terminal, "|%s|\n", buffer[i]);
+    }
+    fputs("+--------------------+\n", terminal);
+    fflush(terminal);
+  }
+
+  if (path){
+    // Replace the file as a whole, readers never see half a screen
+    snprintf(_temp, sizeof(_temp), "%s.tmp", path);
+    _file = fopen(_temp, "w");
+    if (_file){
+      for (byte i = 0; i < LCD_ROWS; i++){
+        fprintf(_file, "%s\n", buffer[i]);
+      }
+      fclose(_file);
+      rename(_temp, path);
+    }
+  }
+}
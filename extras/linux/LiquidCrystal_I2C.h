@@ -0,0 +1,58 @@
+/*
+  LiquidCrystal_I2C.h - 20x4 screen buffer rendered to a terminal or file
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LiquidCrystal_I2C_h
+#define LiquidCrystal_I2C_h
+
+#include "Arduino.h"
+
+#define LCD_COLUMNS       20
+#define LCD_ROWS          4
+
+class LiquidCrystal_I2C {
+private:
+  //-------------
+  // data members
+  //-------------
+  char buffer[LCD_ROWS][LCD_COLUMNS + 1];
+  boolean changed;
+
+  // Output, terminal (ANSI) or a file rewritten on every render
+  FILE * terminal;
+  const char * path;
+public:
+  // Constructor
+  LiquidCrystal_I2C();
+
+  // Same buffer interface as the I2C display
+  void write_buffer(const char * _text, int _row);
+  void write_buffer(char _c, int _row, int _column);
+  void write_screen(int _count);
+
+  inline void setTerminal(FILE * _terminal){
+    terminal = _terminal;
+  };
+  inline void setPath(const char * _path){
+    path = _path;
+  };
+
+  void render();
+};
+
+#endif
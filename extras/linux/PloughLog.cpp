@@ -0,0 +1,123 @@
+/*
+  PloughLog.cpp - binary log of every tick in a memory-mapped ring file
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "PloughLog.h"
+
+// -----------
+// Constructor
+// -----------
+PloughLog::PloughLog(){
+  header = 0;
+  records = 0;
+  size = 0;
+}
+
+PloughLog::~PloughLog(){
+  close();
+}
+
+// -------------------------------------------------------------------
+// Method for opening the ring file, an existing file with the same
+// layout is appended to, anything else is replaced by an empty ring
+// -------------------------------------------------------------------
+bool PloughLog::open(const char * _path, uint64_t _capacity){
+  struct stat _stat;
+  bool _reuse = false;
+  int _fd;
+
+  close();
+
+  _fd = ::open(_path, O_RDWR | O_CREAT, 0644);
+  if (_fd < 0){
+    perror(_path);
+    return false;
+  }
+
+  size = sizeof(PloughLogHeader) + _capacity * sizeof(PloughLogRecord);
+
+  if (fstat(_fd, &_stat) == 0 && (uint64_t)_stat.st_size == size){
+    _reuse = true;
+  }
+  // Allocate the whole file now, so a full disk shows at start and not
+  // as a SIGBUS halfway through the season
+  else if (ftruncate(_fd, 0) < 0 || posix_fallocate(_fd, 0, size) != 0){
+    perror(_path);
+    ::close(_fd);
+    return false;
+  }
+
+  header = (PloughLogHeader *)mmap(0, size, PROT_READ | PROT_WRITE,
+                                   MAP_SHARED, _fd, 0);
+  ::close(_fd);
+  if (header == MAP_FAILED){
+    perror(_path);
+    header = 0;
+    return false;
+  }
+  records = (PloughLogRecord *)(header + 1);
+
+  if (!_reuse ||
+      header->magic != PLOUGH_LOG_MAGIC ||
+      header->version != PLOUGH_LOG_VERSION ||
+      header->record_size != sizeof(PloughLogRecord) ||
+      header->capacity != _capacity){
+    memset(header, 0, sizeof(PloughLogHeader));
+    header->magic = PLOUGH_LOG_MAGIC;
+    header->version = PLOUGH_LOG_VERSION;
+    header->record_size = sizeof(PloughLogRecord);
+    header->capacity = _capacity;
+  }
+
+  return true;
+}
+
+// ---------------------------------------------------------------------
+// Method for appending a record, a copy and a store, no system calls;
+// the kernel writes dirty pages back in its own time
+// ---------------------------------------------------------------------
+void PloughLog::append(const PloughLogRecord & _record){
+  uint64_t _count;
+
+  if (!header){
+    return;
+  }
+
+  _count = header->count;
+  memcpy(&records[_count % header->capacity], &_record, sizeof(_record));
+  __atomic_store_n(&header->count, _count + 1, __ATOMIC_RELEASE);
+}
+
+// ------------------------------------------------
+// Method for closing, dirty pages are written back
+// ------------------------------------------------
+void PloughLog::close(){
+  if (header){
+    msync(header, size, MS_SYNC);
+    munmap(header, size);
+    header = 0;
+    records = 0;
+  }
+}
@@ -0,0 +1,88 @@
+/*
+  PloughLog.h - binary log of every tick in a memory-mapped ring file
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ The file is a header followed by a fixed number of records, allocated
+ when the file is created. Record n is stored in slot n % capacity, so the
+ file never grows and the oldest records are overwritten. count is only
+ stored after the record itself, a reader never sees a half record.
+
+ All fields are little endian. A changed layout gets a new version.
+*/
+
+#ifndef PloughLog_h
+#define PloughLog_h
+
+#include <stdint.h>
+
+#define PLOUGH_LOG_MAGIC      0x474f4c50UL   // "PLOG"
+#define PLOUGH_LOG_VERSION    1
+#define PLOUGH_LOG_RECORDS    (1UL << 22)    // 4M records, 80 MB
+
+// Record flags
+#define PLOUGH_LOG_SIDE       0x01
+#define PLOUGH_LOG_HITCH      0x02
+#define PLOUGH_LOG_MANUAL     0x04
+#define PLOUGH_LOG_MIN_SPEED  0x08
+#define PLOUGH_LOG_XTE_FIX    0x10           // new XTE this tick
+#define PLOUGH_LOG_OVERRUN    0x20
+#define PLOUGH_LOG_START      0x40           // first tick after start
+
+// File header, 64 bytes
+struct PloughLogHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint64_t capacity;      // records
+  uint64_t count;         // records ever written
+  uint8_t reserved[40];
+};
+
+// One tick, 20 bytes
+struct __attribute__((packed)) PloughLogRecord {
+  uint32_t time;          // ms
+  uint8_t mode;           // 0 AUTO, 1 HOLD, 2 MANUAL, 3 CALIBRATE
+  char hold;              // HOLD reason: O(verrun), G(PS), S(peed)
+  uint8_t implement;      // shown implement
+  uint8_t flags;
+  int16_t offset;         // cm
+  int16_t position;       // cm
+  int16_t rotation;       // deg
+  int16_t xte;            // cm
+  uint8_t quality;
+  int8_t buttons;         // -1 left, 1 right, 0 none
+  uint16_t loop_period;   // ms
+};
+
+// -------------------------------------------------
+// Writer, appends to the ring file
+// -------------------------------------------------
+class PloughLog {
+private:
+  PloughLogHeader * header;
+  PloughLogRecord * records;
+  uint64_t size;
+public:
+  PloughLog();
+  ~PloughLog();
+
+  bool open(const char * _path, uint64_t _capacity);
+  void append(const PloughLogRecord & _record);
+  void close();
+};
+
+#endif
@@ -0,0 +1,94 @@
+/*
+  PloughState.h - interface state shared with other processes
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ ploughd publishes the state of every tick in a POSIX shared memory object.
+ The single writer never waits and makes no system calls. Readers map the
+ object read-only and copy a consistent state with readPloughState(); they
+ retry while the sequence is odd or changed during the copy (seqlock).
+*/
+
+#ifndef PloughState_h
+#define PloughState_h
+
+#include <stdint.h>
+#include <string.h>
+
+#define PLOUGH_STATE_NAME     "/ploughd"
+#define PLOUGH_STATE_VERSION  1
+
+// State of one tick, plain fixed-size types only
+struct PloughStateData {
+  uint32_t tick;          // ticks since start
+  uint32_t time;          // ms
+  uint8_t mode;           // 0 AUTO, 1 HOLD, 2 MANUAL, 3 CALIBRATE
+  char hold;              // HOLD reason: O(verrun), G(PS), S(peed)
+  uint8_t side;
+  uint8_t implement;      // shown implement
+  int16_t offset;         // cm
+  int16_t position;       // cm
+  int16_t rotation;       // deg
+  int16_t xte;            // cm
+  uint8_t quality;
+  uint8_t min_speed;
+  uint8_t manual;
+  uint8_t hitch;
+  uint32_t xte_age;       // ms since last XTE fix
+  uint32_t loop_period;   // ms between loop calls
+  uint32_t tick_time;     // us spent in the last update()
+  uint32_t tick_max;      // us longest update() so far
+};
+
+// Shared object, written by ploughd only
+struct PloughState {
+  uint32_t version;
+  uint32_t sequence;      // odd while the data is being written
+  PloughStateData data;
+};
+
+// ---------------------------------------------
+// Method for publishing a state (single writer)
+// ---------------------------------------------
+inline void writePloughState(PloughState * _state, const PloughStateData & _data){
+  uint32_t _sequence = _state->sequence;
+
+  __atomic_store_n(&_state->sequence, _sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  memcpy(&_state->data, &_data, sizeof(_data));
+
+  __atomic_store_n(&_state->sequence, _sequence + 2, __ATOMIC_RELEASE);
+}
+
+// ------------------------------------------------------------------
+// Method for copying a consistent state, returns the sequence number
+// ------------------------------------------------------------------
+inline uint32_t readPloughState(const PloughState * _state, PloughStateData & _data){
+  uint32_t _before;
+  uint32_t _after;
+
+  do {
+    _before = __atomic_load_n(&_state->sequence, __ATOMIC_ACQUIRE);
+    memcpy(&_data, &_state->data, sizeof(_data));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    _after = __atomic_load_n(&_state->sequence, __ATOMIC_RELAXED);
+  } while ((_before & 1) || _before != _after);
+
+  return _before;
+}
+
+#endif
@@ -0,0 +1,173 @@
+/*
+  SimSweep - parameter sweep over simulated field passes, on all cores
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <thread>
+
+#include "SimSweep.h"
+
+const char * const sim_parameter_names[SIM_PARAMETERS] = {
+  "kp", "pwm_auto", "pwm_man", "error", "max_correction", "shares"
+};
+
+// -----------
+// Constructor
+// -----------
+SimSweep::SimSweep(const SimSegment * _script,
+                   byte _segments,
+                   const SimRange * _ranges){
+  script = _script;
+  segments = _segments;
+
+  combinations = 1;
+  for (byte i = 0; i < SIM_PARAMETERS; i++){
+    ranges[i] = _ranges[i];
+    if (ranges[i].step > 0 && ranges[i].max > ranges[i].min){
+      combinations *= (ranges[i].max - ranges[i].min) / ranges[i].step + 1;
+    }
+  }
+
+  next = 0;
+  done = 0;
+}
+
+// --------------------------------------------------
+// Method for sweeping all parameter sets on _threads
+// --------------------------------------------------
+void SimSweep::sweep(unsigned int _threads){
+  std::vector<std::thread> _workers;
+
+  results.assign(combinations, SimResult());
+  next = 0;
+  done = 0;
+
+  if (_threads < 1){
+    _threads = 1;
+  }
+  if (_threads > combinations){
+    _threads = combinations;
+  }
+
+  for (unsigned int i = 0; i < _threads; i++){
+    _workers.push_back(std::thread(&SimSweep::work, this));
+  }
+  for (unsigned int i = 0; i < _threads; i++){
+    _workers[i].join();
+  }
+}
+
+// ------------------------------------------------
+// Method for one worker, runs sets until none left
+// ------------------------------------------------
+void SimSweep::work(){
+  unsigned long _n;
+
+  while ((_n = next.fetch_add(1)) < combinations){
+    decode(_n, results[_n]);
+    run(results[_n]);
+    done++;
+  }
+}
+
+// ---------------------------------------------------------
+// Method for the parameter set of number _n, odometer style
+// ---------------------------------------------------------
+void SimSweep::decode(unsigned long _n, SimResult & _result){
+  unsigned long _count;
+
+  for (byte i = 0; i < SIM_PARAMETERS; i++){
+    _count = 1;
+    if (ranges[i].step > 0 && ranges[i].max > ranges[i].min){
+      _count = (ranges[i].max - ranges[i].min) / ranges[i].step + 1;
+    }
+
+    _result.parameter[i] = ranges[i].min + int(_n % _count) * ranges[i].step;
+    _n /= _count;
+  }
+}
+
+// ----------------------------------------
+// Method for running one isolated instance
+// ----------------------------------------
+void SimSweep::run(SimResult & _result){
+  LiquidCrystal_I2C _lcd;
+  SimField _field(script, segments);
+  ImplementPlough _implement(&_field);
+  VehicleGps _gps(&_field);
+  VehicleTractor _tractor(&_field);
+  InterfacePlough<> _interface(&_lcd, &_implement, &_tractor, &_gps);
+
+  _field.quiet = true;
+  _field.realtime = false;
+
+  // Switch in automatic, buttons released
+  arduino_pins[MODE_PIN] = HIGH;
+
+  _implement.setKP(_result.parameter[SIM_KP]);
+  _implement.setPwmAuto(byte(_result.parameter[SIM_PWM_AUTO]));
+  _implement.setPwmMan(byte(_result.parameter[SIM_PWM_MAN]));
+  _implement.setError(byte(_result.parameter[SIM_ERROR]));
+  _implement.setMaxCorrection(_result.parameter[SIM_MAXCOR]);
+  _implement.setShares(_result.parameter[SIM_SHARES]);
+
+  // One complete pass
+  while (!_field.getPasses()){
+    _interface.update();
+  }
+
+  _result.score = _field.getScore();
+  _result.cost = _result.score.rms +
+                 (unsigned long)_result.score.effort * SIM_SWEEP_EFFORT;
+}
+
+// -----------------------------------------------
+// Method for writing every result, ranked, as CSV
+// -----------------------------------------------
+void SimSweep::report(FILE * _file){
+  std::vector<const SimResult *> _ranking;
+
+  for (unsigned long i = 0; i < results.size(); i++){
+    _ranking.push_back(&results[i]);
+  }
+
+  // Equal costs keep the order of the queue
+  std::stable_sort(_ranking.begin(), _ranking.end(),
+                   [](const SimResult * _a, const SimResult * _b){
+                     return _a->cost < _b->cost;
+                   });
+
+  fputs("rank", _file);
+  for (byte j = 0; j < SIM_PARAMETERS; j++){
+    fprintf(_file, ",%s", sim_parameter_names[j]);
+  }
+  fputs(",rms_0.1mm,duty_pct,settle_ms,overshoot_pct,cost\n", _file);
+
+  for (unsigned long i = 0; i < _ranking.size(); i++){
+    fprintf(_file, "%lu", i + 1);
+    for (byte j = 0; j < SIM_PARAMETERS; j++){
+      fprintf(_file, ",%d", _ranking[i]->parameter[j]);
+    }
+    fprintf(_file, ",%u,%u,%lu,%u,%lu\n",
+            _ranking[i]->score.rms,
+            _ranking[i]->score.effort,
+            _ranking[i]->score.settle,
+            _ranking[i]->score.overshoot,
+            _ranking[i]->cost);
+  }
+}
@@ -0,0 +1,106 @@
+/*
+  SimSweep - parameter sweep over simulated field passes, on all cores
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Every parameter set is a number in the shared queue. Each worker thread
+ takes the next number, runs one isolated SimField/InterfacePlough pass
+ for it and stores the result in the slot of that number, so a slow run
+ never holds up the others and the results do not depend on the threads.
+*/
+
+#ifndef SimSweep_h
+#define SimSweep_h
+
+#include <atomic>
+#include <vector>
+
+#include "InterfacePlough.h"
+
+// Weight of valve duty (%) against RMS tracking error (0.1 mm) in the ranking
+#define SIM_SWEEP_EFFORT  5
+
+// Swept parameters
+#define SIM_KP            0
+#define SIM_PWM_AUTO      1
+#define SIM_PWM_MAN       2
+#define SIM_ERROR         3
+#define SIM_MAXCOR        4
+#define SIM_SHARES        5
+#define SIM_PARAMETERS    6
+
+// Range of a swept parameter, a step of 0 keeps it at min
+struct SimRange {
+  int min;
+  int max;
+  int step;
+};
+
+// Result of one simulated run
+struct SimResult {
+  int parameter[SIM_PARAMETERS];
+  SimScore score;
+  unsigned long cost;
+};
+
+class SimSweep {
+private:
+  //-------------
+  // data members
+  //-------------
+
+  // Shared, read-only field pass and ranges
+  const SimSegment * script;
+  byte segments;
+  SimRange ranges[SIM_PARAMETERS];
+
+  // Queue of parameter sets and one result per set
+  unsigned long combinations;
+  std::atomic<unsigned long> next;
+  std::atomic<unsigned long> done;
+  std::vector<SimResult> results;
+
+  // -------------------------------------------
+  // private member functions
+  // -------------------------------------------
+  void work();
+  void decode(unsigned long _n, SimResult & _result);
+  void run(SimResult & _result);
+public:
+  // ----------------------------------------------------
+  // public member functions implemented in SimSweep.cpp
+  // ----------------------------------------------------
+
+  // Constructor
+  SimSweep(const SimSegment * _script,
+           byte _segments,
+           const SimRange * _ranges);
+
+  void sweep(unsigned int _threads);
+  void report(FILE * _file);
+
+  inline unsigned long getCombinations(){
+    return combinations;
+  };
+  inline unsigned long getRuns(){
+    return done.load();
+  };
+};
+
+// Names of the swept parameters, also the CSV columns
+extern const char * const sim_parameter_names[SIM_PARAMETERS];
+
+#endif
@@ -0,0 +1,290 @@
+/*
+  buttonfuzz - property test of InterfacePlough::checkButtons()
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Plays random button sequences into checkButtons(), with random delays
+ and a random call period, on a clock the test steps itself. Half of the
+ scenarios start just before 0xFFFFFFFF, where millis() wraps on the
+ AVR; the other half just before the wrap of unsigned long on this host,
+ so (now - timer) really wraps around in every run. After every call
+ the result is checked against what the pins did:
+
+   - 2 only when both buttons have been held for _delay1 * 4 ms, then
+     again every _delay1 * 4 ms; never for presses that do not overlap
+   - a single press gives its direction once on release when it was
+     shorter than _delay2 (no lost short taps), else every _delay2 ms
+     while held and nothing on release
+   - nothing after a chord until both buttons are released
+
+ Every press and release lasts at least one call period, so the pins are
+ sampled in each state. Repeats may come up to two call periods late: the
+ repeat timer restarts on the call after a repeat.
+
+ usage: buttonfuzz [-n scenarios] [-s seed] [-v]
+
+   -n  number of scenarios (default 20000)
+   -s  seed of the first scenario (default 1)
+   -v  print every failing call instead of the first of each scenario
+*/
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "InterfacePlough.h"
+
+// Pin states
+#define NONE              0
+#define LEFT              1
+#define RIGHT             2
+#define BOTH              3
+
+#define PRESSES           24    // presses per scenario
+#define CALL_MAX          30    // ms longest call period
+#define WRAP_MARGIN       5000  // ms before the wrap a scenario may start
+
+static unsigned long clock_now;
+static unsigned long seed;
+
+static unsigned long readClock(){
+  return clock_now;
+}
+
+// ----------------------------------------
+// Method for drawing a number from 0 to _n
+// ----------------------------------------
+static unsigned long draw(unsigned long _n){
+  seed = (seed * 6364136223846793005ULL + 1442695040888963407ULL);
+  return (unsigned long)(seed >> 33) % (_n + 1);
+}
+
+// Checker state of one scenario
+struct Checker {
+  byte d1;
+  byte d2;
+  unsigned long dt_max;
+  byte last;              // pins at the previous call
+  boolean chord;          // both were held since the last release
+  unsigned long start;    // first call of the current run of one state
+  unsigned long event;    // last repeat in this run
+  unsigned long events;   // repeats in this run
+  unsigned long failures;
+};
+
+// --------------------------------------------------------------
+// Method for one call, checks its result against the pin history
+// --------------------------------------------------------------
+static void check(Checker & _c, byte _pins, int _result, bool _verbose,
+                  unsigned long _scenario){
+  int _sign = _pins == LEFT ? -1 : 1;
+  unsigned long _period = _pins == BOTH ? _c.d1 * 4UL : _c.d2;
+  unsigned long _since;
+  const char * _error = 0;
+
+  // A new run of one pin state
+  if (_pins != _c.last){
+    if (_pins == NONE){
+      // Release: the tap of a single press that never repeated
+      int _expect = 0;
+      if (_c.last != BOTH && !_c.chord && !_c.events){
+        _expect = _c.last == LEFT ? -1 : 1;
+      }
+      if (_result != _expect){
+        _error = _expect ? "lost short tap" : "event on release";
+      }
+      _c.chord = false;
+    }
+    _c.start = clock_now;
+    _c.event = clock_now;
+    _c.events = 0;
+    _c.last = _pins;
+    if (_pins == NONE){
+      goto done;
+    }
+  }
+
+  if (_pins == NONE){
+    if (_result){
+      _error = "event while released";
+    }
+    goto done;
+  }
+
+  if (_pins == BOTH){
+    _c.chord = true;
+  }
+
+  _since = clock_now - (_c.events ? _c.event : _c.start);
+
+  if (_pins == BOTH ? _result == 2 : (!_c.chord && _result == _sign)){
+    // Never early; the first one at most one call late, later ones two
+    if (_since < _period){
+      _error = _pins == BOTH ? "early or spurious chord" : "early repeat";
+    }
+    else if (_since > _period + (_c.events ? 2 : 1) * _c.dt_max){
+      _error = _pins == BOTH ? "late chord" : "late repeat";
+    }
+    _c.event = clock_now;
+    _c.events++;
+  }
+  else if (_result){
+    _error = _pins == BOTH ? "single press during chord" :
+             _c.chord ? "single press after chord" : "wrong direction";
+  }
+  else if (_pins != BOTH && _c.chord){
+    // Nothing expected until release
+  }
+  else if (_since > _period + (_c.events ? 2 : 1) * _c.dt_max){
+    _error = _pins == BOTH ? "missed chord" : "missed repeat";
+  }
+
+done:
+  if (_error){
+    if (_verbose || !_c.failures){
+      printf("scenario %lu: %s at %#lx, pins %d result %d "
+             "(delay1 %u delay2 %u)\n", _scenario, _error, clock_now,
+             _pins, _result, _c.d1, _c.d2);
+    }
+    _c.failures++;
+  }
+}
+
+// -------------------------------------------------
+// Method for running one scenario, returns failures
+// -------------------------------------------------
+static unsigned long scenario(InterfacePlough<> & _interface,
+                              unsigned long _n, bool _verbose){
+  Checker _c;
+  bool _overlap;
+  byte _pins;
+  byte _steps[4];
+  byte _count;
+  int _result;
+  unsigned long _hold;
+  unsigned long _end;
+  unsigned long _chords = 0;
+
+  seed = _n;
+  _c.d1 = byte(draw(4) ? draw(255) : (draw(1) ? 0 : 255));
+  _c.d2 = byte(draw(4) ? draw(255) : (draw(1) ? 0 : 255));
+  _c.dt_max = 1 + draw(CALL_MAX - 1);
+  _c.last = NONE;
+  _c.chord = false;
+  _c.start = 0;
+  _c.event = 0;
+  _c.events = 0;
+  _c.failures = 0;
+  _overlap = draw(1);
+
+  clock_now = (_n & 1 ? 0xFFFFFFFFUL : ULONG_MAX) - draw(WRAP_MARGIN);
+
+  for (byte i = 0; i < PRESSES; i++){
+    // A press, a chord or a rolled chord (one button first), then a release
+    _pins = draw(1) ? LEFT : RIGHT;
+    _steps[0] = _pins;
+    _steps[1] = NONE;
+    _count = 2;
+    if (_overlap && draw(1)){
+      _steps[0] = BOTH;
+      if (draw(1)){
+        _steps[0] = _pins;
+        _steps[1] = BOTH;
+        _steps[2] = _pins ^ BOTH;
+        _steps[3] = NONE;
+        _count = 4;
+      }
+    }
+
+    for (byte j = 0; j < _count; j++){
+      // Short taps, around the delays, and long holds
+      switch (draw(3)){
+      case 0:  _hold = draw(_c.d2 + 1); break;
+      case 1:  _hold = _c.d2 + draw(2 * _c.dt_max); break;
+      case 2:  _hold = _c.d1 * 4UL + draw(2 * _c.dt_max); break;
+      default: _hold = draw(3000); break;
+      }
+      _hold += _c.dt_max;
+
+      _end = clock_now + _hold;
+      while ((long)(clock_now - _end) < 0){
+        arduino_pins[LEFT_BUTTON] = (_steps[j] & LEFT) ? HIGH : LOW;
+        arduino_pins[RIGHT_BUTTON] = (_steps[j] & RIGHT) ? HIGH : LOW;
+
+        _result = _interface.checkButtons(_c.d1, _c.d2);
+        if (_result == 2){
+          _chords++;
+        }
+        check(_c, _steps[j], _result, _verbose, _n);
+
+        clock_now += 1 + draw(_c.dt_max - 1);
+      }
+    }
+  }
+
+  // No overlap, no chord at all
+  if (!_overlap && _chords){
+    printf("scenario %lu: %lu chords without overlapping presses\n",
+           _n, _chords);
+    _c.failures++;
+  }
+  return _c.failures;
+}
+
+int main(int argc, char ** argv){
+  unsigned long _scenarios = 20000;
+  unsigned long _first = 1;
+  unsigned long _failed = 0;
+  bool _verbose = false;
+  int _option;
+
+  while ((_option = getopt(argc, argv, "n:s:v")) != -1){
+    switch (_option){
+    case 'n': _scenarios = strtoul(optarg, 0, 10); break;
+    case 's': _first = strtoul(optarg, 0, 10); break;
+    case 'v': _verbose = true; break;
+    default:
+      fprintf(stderr, "usage: buttonfuzz [-n scenarios] [-s seed] [-v]\n");
+      return 2;
+    }
+  }
+
+  arduino_clock = readClock;
+
+  for (unsigned long n = _first; n < _first + _scenarios; n++){
+    // checkButtons() only reads the pins and the clock, the simulated
+    // plough is never touched
+    LiquidCrystal_I2C _lcd;
+    ImplementPlough _implement(0);
+    VehicleGps _gps(0);
+    VehicleTractor _tractor(0);
+
+    // Released since before the scenario starts
+    clock_now = 0;
+    arduino_pins[LEFT_BUTTON] = LOW;
+    arduino_pins[RIGHT_BUTTON] = LOW;
+    InterfacePlough<> _interface(&_lcd, &_implement, &_tractor, &_gps);
+    _interface.checkButtons(0, 0);
+
+    if (scenario(_interface, n, _verbose)){
+      _failed++;
+    }
+  }
+
+  printf("buttonfuzz: %lu of %lu scenarios failed\n", _failed, _scenarios);
+  return _failed ? 1 : 0;
+}
@@ -0,0 +1,63 @@
+#!/bin/sh
+#
+#  combos.sh - every feature combination on the SIM stand-ins
+# Copyright (C) 2011-2015 J.A. Woltjer.
+# All rights reserved.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Builds simcombo once per line of extras/footprint/combinations.txt, with
+# the library configured as footprint.sh does, and runs it: a scored field
+# pass, MANUAL with taps and calibrate() with every step declined. The
+# calibration options of the libraries (KP, PWM_MAN, PWM_AUTO, SPEED_L)
+# follow the line (SIM_OPTIONS), so the branches without them are built
+# too. WATCHDOG, IDLE_SLEEP, ADC_SAMPLER and WHEEL_SPEED need the AVR and
+# are switched off under SIM, those lines build as without them.
+#
+# usage: combos.sh
+#
+# Environment:
+#   CXX       default g++
+#   CXXFLAGS  default -O2 -Wall
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+LIBRARY=$(cd "$HERE/../.." && pwd)
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2 -Wall}
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+. "$LIBRARY/extras/footprint/variant.sh"
+
+grep -v '^[[:space:]]*\(#\|$\)' "$LIBRARY/extras/footprint/combinations.txt" > \
+  "$WORK/combinations.txt"
+
+FAILED=0
+COUNT=0
+while read VARIANT FLAGS; do
+  COUNT=$((COUNT + 1))
+  variant "$WORK/$VARIANT" $FLAGS
+
+  SOURCES="$HERE/simcombo.cpp $HERE/Arduino.cpp $HERE/LiquidCrystal_I2C.cpp \
+    $SRC/InterfacePlough.cpp $SRC/LanguagePacked.cpp $SRC/SimPlough.cpp"
+  if grep -q '^#define NMEA_STREAM\b' "$SRC/ConfigInterfacePlough.h"; then
+    SOURCES="$SOURCES $SRC/NmeaStream.cpp"
+  fi
+
+  printf '%-18s ' "$VARIANT"
+  if ! $CXX -DSIM -DSIM_OPTIONS $DEFINES -I"$SRC" -I"$HERE" $CXXFLAGS \
+         -o "$SRC/simcombo" $SOURCES -lrt; then
+    echo "build failed"
+    FAILED=$((FAILED + 1))
+  elif ! "$SRC/simcombo"; then
+    FAILED=$((FAILED + 1))
+  fi
+done < "$WORK/combinations.txt"
+
+echo "combos: $FAILED of $COUNT variants failed"
+[ $FAILED -eq 0 ]
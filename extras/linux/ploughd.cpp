@@ -0,0 +1,521 @@
+/*
+  ploughd - MeijWorks plough interface on a simulated plough, as a Linux daemon
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Runs the unchanged InterfacePlough on NMEA read with NmeaStream from a
+ serial port, on the simulated plough of SimPlough. A timerfd drives the
+ control tick, the GPS port, the input device and signals are read with
+ epoll, never blocking the tick.
+
+ ploughd is a simulator host, for testing the interface against a real
+ receiver or recorded NMEA: it is built with SIM, the valve, the position
+ and rotation sensors and the tractor are those of SimField, and millis()
+ is SimField::now(), which follows the host clock. It drives no hardware.
+
+ The state of every tick is published in shared memory, see PloughState.h,
+ and optionally appended to a binary ring file, see PloughLog.h.
+
+ usage: ploughd [-g tty | -p] [-b baud] [-i input] [-t ms] [-o file]
+                [-l log] [-s name] [-r file [-n records]] [-d]
+
+   -g  GPS serial port
+   -p  create a pseudo-terminal for the GPS and print its name, NMEA
+       written to it is read as from a receiver
+   -b  baud rate of the GPS port (default 38400)
+   -i  input device, FIFO or pty; every byte sets a pin: L/l left button
+       down/up, R/r right button, M/m mode switch to manual/automatic
+   -t  control tick in ms (default 20)
+   -o  write the screen to this file instead of the terminal
+   -l  write Serial output (telemetry, debug) to this file
+   -s  name of the shared memory state (default /ploughd)
+   -r  append every tick to this ring file, read it with ploughlog
+   -n  records in a new ring file (default 4194304)
+   -d  run in the background
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+
+#include "InterfacePlough.h"
+#include "PloughLog.h"
+#include "PloughState.h"
+
+// Bytes buffered between the GPS port and NmeaStream
+#define TTY_BUFFER        4096
+
+// ms between screen renders
+#define RENDER_RATE       100
+
+// ------------------------------------------------
+// GPS port as a Stream, filled from the event loop
+// ------------------------------------------------
+class TtyStream : public Stream {
+private:
+  int fd;
+  byte buffer[TTY_BUFFER];
+  unsigned int head;
+  unsigned int tail;
+public:
+  inline TtyStream(){
+    fd = -1;
+    head = 0;
+    tail = 0;
+  };
+  inline void setFd(int _fd){
+    fd = _fd;
+  };
+  inline int getFd(){
+    return fd;
+  };
+
+  // Read what the port has, bytes that do not fit are dropped
+  void fill(){
+    byte _temp[256];
+    ssize_t _n;
+
+    while ((_n = ::read(fd, _temp, sizeof(_temp))) > 0){
+      for (ssize_t i = 0; i < _n; i++){
+        if ((head + 1) % TTY_BUFFER != tail){
+          buffer[head] = _temp[i];
+          head = (head + 1) % TTY_BUFFER;
+        }
+      }
+    }
+  };
+
+  int available(){
+    return (head + TTY_BUFFER - tail) % TTY_BUFFER;
+  };
+  int read(){
+    int _c;
+
+    if (head == tail){
+      return -1;
+    }
+    _c = buffer[tail];
+    tail = (tail + 1) % TTY_BUFFER;
+    return _c;
+  };
+};
+
+static TtyStream tty;
+
+static int epoll_fd = -1;
+static int timer_fd = -1;
+static int signal_fd = -1;
+static int input_fd = -1;
+
+static PloughLog ring;
+static boolean ring_open = false;
+
+static volatile boolean tick_pending = false;
+static boolean running = true;
+
+// ----------------------------
+// Method for applying an input
+// ----------------------------
+static void input(char _c){
+  switch (_c){
+  case 'L':
+  case 'l':
+    arduino_pins[LEFT_BUTTON] = (_c == 'L') ? HIGH : LOW;
+    break;
+  case 'R':
+  case 'r':
+    arduino_pins[RIGHT_BUTTON] = (_c == 'R') ? HIGH : LOW;
+    break;
+  case 'M':
+  case 'm':
+    // Mode switch pulls the pin low for manual
+    arduino_pins[MODE_PIN] = (_c == 'M') ? LOW : HIGH;
+    break;
+  }
+}
+
+// -------------------------------------------------------------------
+// Method for handling pending events, ticks are only flagged so the
+// interface is never entered again from within one of its own polls
+// -------------------------------------------------------------------
+static void pump(int _timeout){
+  struct epoll_event _events[8];
+  struct signalfd_siginfo _signal;
+  unsigned long long _expirations;
+  char _temp[64];
+  int _n;
+  ssize_t _read;
+
+  _n = epoll_wait(epoll_fd, _events, 8, _timeout);
+
+  for (int i = 0; i < _n; i++){
+    int _fd = _events[i].data.fd;
+
+    if (_fd == timer_fd){
+      if (::read(timer_fd, &_expirations, sizeof(_expirations)) > 0){
+        tick_pending = true;
+      }
+    }
+    else if (_fd == tty.getFd()){
+      tty.fill();
+    }
+    else if (_fd == input_fd){
+      while ((_read = ::read(input_fd, _temp, sizeof(_temp))) > 0){
+        for (ssize_t j = 0; j < _read; j++){
+          input(_temp[j]);
+        }
+      }
+    }
+    else if (_fd == signal_fd){
+      if (::read(signal_fd, &_signal, sizeof(_signal)) > 0){
+        running = false;
+      }
+    }
+  }
+}
+
+// ---------------------------------------
+// Method for adding a descriptor to epoll
+// ---------------------------------------
+static void watch(int _fd){
+  struct epoll_event _event;
+
+  memset(&_event, 0, sizeof(_event));
+  _event.events = EPOLLIN;
+  _event.data.fd = _fd;
+
+  if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, _fd, &_event) < 0){
+    perror("ploughd: epoll_ctl");
+    exit(1);
+  }
+}
+
+// ---------------------------------------
+// Method for setting a serial port to raw
+// ---------------------------------------
+static void raw(int _fd, long _baud){
+  struct termios _tio;
+  speed_t _speed;
+
+  if (tcgetattr(_fd, &_tio) < 0){
+    return;
+  }
+
+  switch (_baud){
+  case 4800:   _speed = B4800;   break;
+  case 9600:   _speed = B9600;   break;
+  case 19200:  _speed = B19200;  break;
+  case 57600:  _speed = B57600;  break;
+  case 115200: _speed = B115200; break;
+  default:     _speed = B38400;  break;
+  }
+
+  cfmakeraw(&_tio);
+  cfsetispeed(&_tio, _speed);
+  cfsetospeed(&_tio, _speed);
+  tcsetattr(_fd, TCSANOW, &_tio);
+}
+
+// -----------------------------------------------
+// Method for creating a pty standing in for a GPS
+// -----------------------------------------------
+static int openPty(){
+  int _master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+  if (_master < 0 || grantpt(_master) < 0 || unlockpt(_master) < 0){
+    perror("ploughd: pty");
+    exit(1);
+  }
+
+  // Keep the slave open ourselves, so the master does not report a hangup
+  // whenever no writer is connected
+  if (open(ptsname(_master), O_RDWR | O_NOCTTY) < 0){
+    perror("ploughd: pty");
+    exit(1);
+  }
+  raw(_master, 38400);
+
+  fprintf(stderr, "ploughd: GPS pty %s\n", ptsname(_master));
+  return _master;
+}
+
+// -------------------------------------------
+// Method for creating the shared memory state
+// -------------------------------------------
+static PloughState * openState(const char * _name){
+  PloughState * _state;
+  int _fd;
+
+  _fd = shm_open(_name, O_CREAT | O_RDWR, 0644);
+  if (_fd < 0 || ftruncate(_fd, sizeof(PloughState)) < 0){
+    perror("ploughd: shm_open");
+    exit(1);
+  }
+
+  _state = (PloughState *)mmap(0, sizeof(PloughState),
+                               PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+  close(_fd);
+  if (_state == MAP_FAILED){
+    perror("ploughd: mmap");
+    exit(1);
+  }
+
+  memset(_state, 0, sizeof(PloughState));
+  _state->version = PLOUGH_STATE_VERSION;
+  return _state;
+}
+
+// ----------------------------------------------
+// Method for appending one tick to the ring file
+// ----------------------------------------------
+static void record(InterfacePlough<> & _interface){
+  static PloughLogRecord _record;
+  static unsigned long _xte_fix = 0;
+  static boolean _first = true;
+  const PloughSnapshot & _snapshot = _interface.getSnapshot();
+  byte _flags = 0;
+
+  if (_snapshot.side) _flags |= PLOUGH_LOG_SIDE;
+  if (_snapshot.hitch) _flags |= PLOUGH_LOG_HITCH;
+  if (_snapshot.manual) _flags |= PLOUGH_LOG_MANUAL;
+  if (_snapshot.min_speed) _flags |= PLOUGH_LOG_MIN_SPEED;
+  if (_snapshot.xte_fix != _xte_fix) _flags |= PLOUGH_LOG_XTE_FIX;
+  if (_interface.getOverrun()) _flags |= PLOUGH_LOG_OVERRUN;
+  if (_first) _flags |= PLOUGH_LOG_START;
+
+  _xte_fix = _snapshot.xte_fix;
+  _first = false;
+
+  _record.time = _snapshot.time;
+  _record.mode = _interface.getMode();
+  _record.hold = _record.mode == 1 ? _interface.getHoldReason() : ' ';
+  _record.implement = _interface.getImplementPage();
+  _record.flags = _flags;
+  _record.offset = _snapshot.offset;
+  _record.position = _snapshot.position;
+  _record.rotation = _snapshot.rotation;
+  _record.xte = _snapshot.xte;
+  _record.quality = _snapshot.quality;
+  _record.buttons = constrain(_interface.getButtons(), -1, 1);
+  _record.loop_period = min(_interface.getLoopPeriod(), 65535UL);
+
+  ring.append(_record);
+}
+
+// -------------------------------------------
+// Method for publishing the state of one tick
+// -------------------------------------------
+static void publish(PloughState * _state,
+                    InterfacePlough<> & _interface,
+                    unsigned long _tick_time){
+  static PloughStateData _data;
+  const PloughSnapshot & _snapshot = _interface.getSnapshot();
+
+  _data.tick++;
+  _data.time = _snapshot.time;
+  _data.mode = _interface.getMode();
+  _data.hold = _data.mode == 1 ? _interface.getHoldReason() : ' ';
+  _data.side = _snapshot.side;
+  _data.implement = _interface.getImplementPage();
+  _data.offset = _snapshot.offset;
+  _data.position = _snapshot.position;
+  _data.rotation = _snapshot.rotation;
+  _data.xte = _snapshot.xte;
+  _data.quality = _snapshot.quality;
+  _data.min_speed = _snapshot.min_speed;
+  _data.manual = _snapshot.manual;
+  _data.hitch = _snapshot.hitch;
+  _data.xte_age = _snapshot.time - _snapshot.xte_fix;
+  _data.loop_period = _interface.getLoopPeriod();
+  _data.tick_time = _tick_time;
+  _data.tick_max = max(_data.tick_max, _data.tick_time);
+
+  writePloughState(_state, _data);
+
+  if (ring_open){
+    record(_interface);
+  }
+}
+
+int main(int argc, char ** argv){
+  const char * _gps = 0;
+  const char * _input = 0;
+  const char * _screen = 0;
+  const char * _log = 0;
+  const char * _name = PLOUGH_STATE_NAME;
+  const char * _ring = 0;
+  unsigned long _records = PLOUGH_LOG_RECORDS;
+  PloughState * _state;
+  unsigned long _start;
+  boolean _pty = false;
+  boolean _background = false;
+  long _baud = 38400;
+  long _tick = 20;
+  unsigned long _render = 0;
+  struct itimerspec _timer;
+  sigset_t _signals;
+  int _option;
+
+  while ((_option = getopt(argc, argv, "g:pb:i:t:o:l:s:r:n:d")) != -1){
+    switch (_option){
+    case 'g': _gps = optarg; break;
+    case 'p': _pty = true; break;
+    case 'b': _baud = atol(optarg); break;
+    case 'i': _input = optarg; break;
+    case 't': _tick = atol(optarg); break;
+    case 'o': _screen = optarg; break;
+    case 'l': _log = optarg; break;
+    case 's': _name = optarg; break;
+    case 'r': _ring = optarg; break;
+    case 'n': _records = strtoul(optarg, 0, 10); break;
+    case 'd': _background = true; break;
+    default:
+      fprintf(stderr, "usage: ploughd [-g tty | -p] [-b baud] [-i input] "
+                      "[-t ms] [-o file] [-l log] [-s name] "
+                      "[-r file [-n records]] [-d]\n");
+      return 2;
+    }
+  }
+
+  if (!_gps && !_pty){
+    fprintf(stderr, "ploughd: no GPS port, use -g or -p\n");
+    return 2;
+  }
+  if (_tick < 1){
+    fprintf(stderr, "ploughd: tick must be at least 1 ms\n");
+    return 2;
+  }
+  fprintf(stderr, "ploughd: simulated plough (SIM), no valve output\n");
+
+  if (_background && daemon(1, 0) < 0){
+    perror("ploughd: daemon");
+    return 1;
+  }
+
+  // Event sources
+  epoll_fd = epoll_create1(0);
+
+  if (_pty){
+    tty.setFd(openPty());
+  }
+  else {
+    tty.setFd(open(_gps, O_RDWR | O_NOCTTY | O_NONBLOCK));
+    if (tty.getFd() < 0){
+      perror(_gps);
+      return 1;
+    }
+    raw(tty.getFd(), _baud);
+  }
+  watch(tty.getFd());
+
+  if (_input){
+    // Read-write, a FIFO then never reports end of file
+    input_fd = open(_input, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (input_fd < 0){
+      perror(_input);
+      return 1;
+    }
+    raw(input_fd, 38400);
+    watch(input_fd);
+  }
+
+  sigemptyset(&_signals);
+  sigaddset(&_signals, SIGINT);
+  sigaddset(&_signals, SIGTERM);
+  sigprocmask(SIG_BLOCK, &_signals, 0);
+  signal_fd = signalfd(-1, &_signals, SFD_NONBLOCK);
+  watch(signal_fd);
+
+  timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+  memset(&_timer, 0, sizeof(_timer));
+  _timer.it_interval.tv_sec = _tick / 1000;
+  _timer.it_interval.tv_nsec = _tick % 1000 * 1000000L;
+  _timer.it_value = _timer.it_interval;
+  timerfd_settime(timer_fd, 0, &_timer, 0);
+  watch(timer_fd);
+
+  if (_log){
+    FILE * _file = fopen(_log, "a");
+    if (_file){
+      Serial.setFile(_file);
+    }
+  }
+
+  _state = openState(_name);
+
+  if (_ring){
+    if (_records == 0 || !ring.open(_ring, _records)){
+      fprintf(stderr, "ploughd: cannot open ring file %s\n", _ring);
+      return 1;
+    }
+    ring_open = true;
+  }
+
+  // Interface on the simulated plough, GPS from the port
+  SimField field(SIM_PASS, SIM_PASS_SEGMENTS);
+  ImplementPlough implement(&field);
+  VehicleTractor tractor(&field);
+  NmeaStream gps(&tty);
+  LiquidCrystal_I2C lcd;
+  InterfacePlough<> interface(&lcd, &implement, &tractor, &gps);
+
+  field.quiet = true;
+
+  if (_screen){
+    lcd.setPath(_screen);
+  }
+  else if (!_background){
+    fputs("\033[2J", stdout);
+    lcd.setTerminal(stdout);
+  }
+
+  // Switch in automatic, buttons released
+  arduino_pins[MODE_PIN] = HIGH;
+  arduino_poll = pump;
+
+  interface.updateScreen(1);
+
+  while (running){
+    pump(-1);
+
+    if (tick_pending){
+      tick_pending = false;
+
+      _start = (micros)();
+      interface.update();
+      publish(_state, interface, (micros)() - _start);
+
+      if ((millis)() - _render >= RENDER_RATE){
+        _render = (millis)();
+        lcd.render();
+      }
+    }
+  }
+
+  implement.stop();
+  shm_unlink(_name);
+  ring.close();
+  return 0;
+}
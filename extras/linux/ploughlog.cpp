@@ -0,0 +1,265 @@
+/*
+  ploughlog - analyses the ring file written by ploughd
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Maps the file read-only and makes one pass over the records, oldest
+ first, without copying or parsing them. Reports the time in each mode,
+ the reasons for HOLD, the XTE RMS of every pass and the actuator duty.
+
+ The time between two records counts for the first of the two. Gaps
+ longer than -g (a restart, a stalled daemon) are not counted.
+
+ A pass is a run of records on the same plough side; turning the plough
+ at the headland starts the next one. Its RMS is over the XTE fixes
+ received in AUTO, so it does not depend on the control tick.
+
+ The actuator counts as driven while the position changes between
+ records; the valve drive itself stays inside the implement.
+
+ usage: ploughlog [-q] [-g ms] file
+
+   -q  summary only, no line per pass
+   -g  longest gap between records that is counted (default 1000)
+*/
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "PloughLog.h"
+
+#define MODES 4
+
+static const char * modes[MODES] = {"AUTO", "HOLD", "MANUAL", "CALIBRATE"};
+
+// Reasons for HOLD, anything else is counted as other
+static const char holds[] = "OGS";
+static const char * hold_names[] = {"overrun", "GPS", "speed", "other"};
+
+// Statistics of one pass
+struct Pass {
+  uint64_t start;         // ms since first record
+  uint64_t end;
+  uint64_t samples;
+  double sum;             // of xte^2, cm^2
+  int max;                // cm
+};
+
+// -----------------------------------
+// Method for printing a time in h:m:s
+// -----------------------------------
+static void printTime(uint64_t _ms){
+  uint64_t _s = _ms / 1000;
+
+  printf("%4llu:%02llu:%02llu", (unsigned long long)(_s / 3600),
+         (unsigned long long)(_s / 60 % 60), (unsigned long long)(_s % 60));
+}
+
+// --------------------------------
+// Method for printing a percentage
+// --------------------------------
+static void printShare(uint64_t _part, uint64_t _whole){
+  printf(" %5.1f%%", _whole ? 100.0 * _part / _whole : 0.0);
+}
+
+// ------------------------------------------
+// Method for closing a pass, prints its line
+// ------------------------------------------
+static void closePass(Pass & _pass, uint64_t & _passes, bool _quiet){
+  if (_pass.samples){
+    _passes++;
+    if (!_quiet){
+      printf("pass %5llu ", (unsigned long long)_passes);
+      printTime(_pass.start);
+      printf(" %6.0f s %7llu fixes  rms %6.1f cm  max %4d cm\n",
+             (_pass.end - _pass.start) / 1000.0,
+             (unsigned long long)_pass.samples,
+             sqrt(_pass.sum / _pass.samples), _pass.max);
+    }
+  }
+  _pass.samples = 0;
+  _pass.sum = 0;
+  _pass.max = 0;
+}
+
+int main(int argc, char ** argv){
+  const PloughLogHeader * _header;
+  const PloughLogRecord * _records;
+  const PloughLogRecord * _record;
+  const PloughLogRecord * _last = 0;
+  struct stat _stat;
+  bool _quiet = false;
+  uint64_t _gap = 1000;
+  uint64_t _first;
+  uint64_t _count;
+  uint64_t _slot;
+  uint64_t _clock = 0;
+  uint64_t _dt;
+  int _fd;
+  int _option;
+
+  // Totals
+  uint64_t _mode_time[MODES] = {0};
+  uint64_t _drive_time[MODES] = {0};
+  uint64_t _hold_time[4] = {0};
+  uint64_t _gaps = 0;
+  uint64_t _passes = 0;
+  uint64_t _samples = 0;
+  double _sum = 0;
+  Pass _pass = {0, 0, 0, 0, 0};
+
+  while ((_option = getopt(argc, argv, "qg:")) != -1){
+    switch (_option){
+    case 'q': _quiet = true; break;
+    case 'g': _gap = strtoull(optarg, 0, 10); break;
+    default:
+      fprintf(stderr, "usage: ploughlog [-q] [-g ms] file\n");
+      return 2;
+    }
+  }
+  if (optind != argc - 1){
+    fprintf(stderr, "usage: ploughlog [-q] [-g ms] file\n");
+    return 2;
+  }
+
+  _fd = open(argv[optind], O_RDONLY);
+  if (_fd < 0 || fstat(_fd, &_stat) < 0){
+    perror(argv[optind]);
+    return 1;
+  }
+  if ((uint64_t)_stat.st_size < sizeof(PloughLogHeader)){
+    fprintf(stderr, "ploughlog: %s is not a ring file\n", argv[optind]);
+    return 1;
+  }
+
+  _header = (const PloughLogHeader *)mmap(0, _stat.st_size, PROT_READ,
+                                          MAP_SHARED, _fd, 0);
+  close(_fd);
+  if (_header == MAP_FAILED){
+    perror(argv[optind]);
+    return 1;
+  }
+  madvise((void *)_header, _stat.st_size, MADV_SEQUENTIAL);
+
+  if (_header->magic != PLOUGH_LOG_MAGIC ||
+      _header->version != PLOUGH_LOG_VERSION ||
+      _header->record_size != sizeof(PloughLogRecord) ||
+      _header->capacity == 0 ||
+      sizeof(PloughLogHeader) + _header->capacity * sizeof(PloughLogRecord) >
+      (uint64_t)_stat.st_size){
+    fprintf(stderr, "ploughlog: %s is not a version %d ring file\n",
+            argv[optind], PLOUGH_LOG_VERSION);
+    return 1;
+  }
+  _records = (const PloughLogRecord *)(_header + 1);
+
+  // Oldest record still in the ring
+  _count = __atomic_load_n(&_header->count, __ATOMIC_ACQUIRE);
+  _first = _count > _header->capacity ? _count - _header->capacity : 0;
+  _slot = _first % _header->capacity;
+
+  for (uint64_t i = _first; i < _count; i++){
+    _record = &_records[_slot];
+    if (++_slot == _header->capacity){
+      _slot = 0;
+    }
+
+    if (_last){
+      _dt = (uint32_t)(_record->time - _last->time);
+
+      if ((_record->flags & PLOUGH_LOG_START) || _dt > _gap){
+        _gaps++;
+        closePass(_pass, _passes, _quiet);
+      }
+      else {
+        _clock += _dt;
+
+        if (_last->mode < MODES){
+          _mode_time[_last->mode] += _dt;
+          if (_record->position != _last->position){
+            _drive_time[_last->mode] += _dt;
+          }
+        }
+        if (_last->mode == 1){
+          int _reason = 0;
+
+          while (holds[_reason] && holds[_reason] != _last->hold){
+            _reason++;
+          }
+          _hold_time[_reason] += _dt;
+        }
+      }
+
+      // Plough turned, next pass
+      if ((_record->flags ^ _last->flags) & PLOUGH_LOG_SIDE){
+        closePass(_pass, _passes, _quiet);
+      }
+    }
+
+    if (_record->mode == 0 && (_record->flags & PLOUGH_LOG_XTE_FIX)){
+      if (!_pass.samples){
+        _pass.start = _clock;
+      }
+      _pass.end = _clock;
+      _pass.samples++;
+      _pass.sum += (double)_record->xte * _record->xte;
+      if (abs(_record->xte) > _pass.max){
+        _pass.max = abs(_record->xte);
+      }
+
+      _samples++;
+      _sum += (double)_record->xte * _record->xte;
+    }
+
+    _last = _record;
+  }
+  closePass(_pass, _passes, _quiet);
+
+  // Summary
+  printf("records %llu of %llu kept, %llu sessions or gaps, ",
+         (unsigned long long)(_count - _first), (unsigned long long)_count,
+         (unsigned long long)_gaps);
+  printTime(_clock);
+  printf(" logged\n");
+
+  printf("\n%-9s %10s%7s%7s\n", "mode", "time", "share", "driven");
+  for (int i = 0; i < MODES; i++){
+    printf("%-9s ", modes[i]);
+    printTime(_mode_time[i]);
+    printShare(_mode_time[i], _clock);
+    printShare(_drive_time[i], _mode_time[i]);
+    printf("\n");
+  }
+
+  printf("\n%-9s %10s%7s\n", "hold", "time", "share");
+  for (int i = 0; i < 4; i++){
+    printf("%-9s ", hold_names[i]);
+    printTime(_hold_time[i]);
+    printShare(_hold_time[i], _mode_time[1]);
+    printf("\n");
+  }
+
+  printf("\nxte %llu passes, %llu fixes, rms %.1f cm\n",
+         (unsigned long long)_passes, (unsigned long long)_samples,
+         _samples ? sqrt(_sum / _samples) : 0.0);
+
+  return 0;
+}
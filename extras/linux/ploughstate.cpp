@@ -0,0 +1,110 @@
+/*
+  ploughstate - prints the state published by ploughd
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Maps the shared memory state read-only, so it never disturbs the daemon.
+
+ usage: ploughstate [-s name] [-w ms]
+
+   -s  name of the shared memory state (default /ploughd)
+   -w  print again every ms, only when a new tick was published
+*/
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "PloughState.h"
+
+static const char * modes[] = {"AUTO", "HOLD", "MANUAL", "CALIBRATE"};
+
+// -----------------------------
+// Method for printing one state
+// -----------------------------
+static void print(const PloughStateData & _data){
+  printf("tick %u time %u %s", _data.tick, _data.time,
+         _data.mode < 4 ? modes[_data.mode] : "?");
+  if (_data.mode == 1){
+    printf(" (%c)", _data.hold);
+  }
+  printf(" implement %u side %u\n", _data.implement + 1, _data.side);
+
+  printf("  offset %d position %d rotation %d xte %d age %u\n",
+         _data.offset, _data.position, _data.rotation, _data.xte,
+         _data.xte_age);
+  printf("  quality %u speed %u manual %u hitch %u\n",
+         _data.quality, _data.min_speed, _data.manual, _data.hitch);
+  printf("  loop %u ms update %u us max %u us\n",
+         _data.loop_period, _data.tick_time, _data.tick_max);
+  fflush(stdout);
+}
+
+int main(int argc, char ** argv){
+  const char * _name = PLOUGH_STATE_NAME;
+  const PloughState * _state;
+  PloughStateData _data;
+  uint32_t _sequence;
+  uint32_t _last = 0;
+  long _wait = 0;
+  int _fd;
+  int _option;
+
+  while ((_option = getopt(argc, argv, "s:w:")) != -1){
+    switch (_option){
+    case 's': _name = optarg; break;
+    case 'w': _wait = atol(optarg); break;
+    default:
+      fprintf(stderr, "usage: ploughstate [-s name] [-w ms]\n");
+      return 2;
+    }
+  }
+
+  _fd = shm_open(_name, O_RDONLY, 0);
+  if (_fd < 0){
+    perror("ploughstate: shm_open");
+    return 1;
+  }
+
+  _state = (const PloughState *)mmap(0, sizeof(PloughState), PROT_READ,
+                                     MAP_SHARED, _fd, 0);
+  close(_fd);
+  if (_state == MAP_FAILED){
+    perror("ploughstate: mmap");
+    return 1;
+  }
+
+  if (_state->version != PLOUGH_STATE_VERSION){
+    fprintf(stderr, "ploughstate: version %u, expected %u\n",
+            _state->version, PLOUGH_STATE_VERSION);
+    return 1;
+  }
+
+  do {
+    _sequence = readPloughState(_state, _data);
+    if (_sequence != _last){
+      print(_data);
+      _last = _sequence;
+    }
+    if (_wait > 0){
+      usleep(_wait * 1000);
+    }
+  } while (_wait > 0);
+
+  return 0;
+}
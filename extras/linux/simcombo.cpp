@@ -0,0 +1,166 @@
+/*
+  simcombo - one feature set of the library on the SIM stand-ins
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Runs the default field pass (SIM_PASS) in AUTO and checks its RMS
+ tracking error, then COMBO_MANUAL ms in MANUAL with left and right taps,
+ then calibrate(), declining every step with left taps, as the simavr
+ profile does. combos.sh builds it once per line of
+ extras/footprint/combinations.txt.
+
+ The pass runs one simulation step per GPS update, the other phases on a
+ clock that advances 1 ms each time the library polls a pin or waits, so
+ the blocking calibrate() runs at full speed. With NMEA_STREAM the GPS is
+ NmeaStream on a Serial without input: the AUTO phase then runs
+ COMBO_MANUAL ms on that clock and has to hold, unscored.
+
+ usage: simcombo [-r rms]
+
+   -r  fail when the RMS tracking error of the pass is above this
+       (default 600, 0.1 mm)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "InterfacePlough.h"
+
+#define COMBO_PASS_MAX    600000UL  // ms longest simulated pass
+#define COMBO_MANUAL      20000UL   // ms in MANUAL
+#define COMBO_CALIBRATE   600000UL  // ms longest calibrate()
+#define TAP_PERIOD        700       // ms between taps
+#define TAP_LENGTH        100       // ms a tap is held
+
+// Buttons played on the clock
+#define SCRIPT_NONE       0
+#define SCRIPT_TAP        1         // left and right in turn
+#define SCRIPT_DECLINE    2         // left only
+
+static unsigned long clock_now;
+static unsigned long clock_limit;
+static byte script;
+static unsigned int rms_max = 600;
+
+static unsigned long readClock(){
+  return clock_now;
+}
+
+// ----------------------------------------------
+// Method for advancing the clock and the buttons
+// ----------------------------------------------
+static void poll(int _timeout){
+  boolean _pressed = clock_now % TAP_PERIOD < TAP_LENGTH;
+  boolean _left = script == SCRIPT_DECLINE ||
+                  (clock_now / TAP_PERIOD) % 2 == 0;
+
+  clock_now++;
+  if (clock_limit && clock_now > clock_limit){
+    printf("simcombo: calibrate() did not return in %lu ms\n",
+           COMBO_CALIBRATE);
+    exit(1);
+  }
+
+  arduino_pins[LEFT_BUTTON] = script && _pressed && _left ? HIGH : LOW;
+  arduino_pins[RIGHT_BUTTON] = script && _pressed && !_left ? HIGH : LOW;
+}
+
+int main(int argc, char ** argv){
+  unsigned long _start;
+  unsigned long _end;
+  int _option;
+
+  while ((_option = getopt(argc, argv, "r:")) != -1){
+    switch (_option){
+    case 'r': rms_max = strtoul(optarg, 0, 10); break;
+    default:
+      fprintf(stderr, "usage: simcombo [-r rms]\n");
+      return 2;
+    }
+  }
+
+  arduino_clock = readClock;
+  arduino_poll = poll;
+  clock_now = 0;
+  script = SCRIPT_NONE;
+
+  // Telemetry and debug output of the library is not checked
+  Serial.setFile(fopen("/dev/null", "w"));
+
+  LiquidCrystal_I2C _lcd;
+  SimField _field(SIM_PASS, SIM_PASS_SEGMENTS);
+  ImplementPlough _implement(&_field);
+#ifdef NMEA_STREAM
+  VehicleGps _gps(&Serial);
+#else
+  VehicleGps _gps(&_field);
+#endif
+  VehicleTractor _tractor(&_field);
+  InterfacePlough<> _interface(&_lcd, &_implement, &_tractor, &_gps);
+
+  _field.quiet = true;
+
+  // Switch in automatic, buttons released
+  arduino_pins[MODE_PIN] = HIGH;
+
+#ifdef NMEA_STREAM
+  _end = clock_now + COMBO_MANUAL;
+  while (clock_now < _end){
+    _interface.update();
+  }
+  if (_interface.getMode() != 1){
+    printf("simcombo: AUTO without fixes, mode %u\n", _interface.getMode());
+    return 1;
+  }
+  printf("simcombo: no fixes, holds");
+#else
+  // One complete pass, one simulation step per GPS update
+  _field.realtime = false;
+  while (!_field.getPasses()){
+    _interface.update();
+    if (_field.getTime() > COMBO_PASS_MAX){
+      printf("simcombo: no pass in %lu ms\n", COMBO_PASS_MAX);
+      return 1;
+    }
+  }
+  _field.realtime = true;
+
+  if (_field.getScore().rms > rms_max){
+    printf("simcombo: rms %u above %u\n", _field.getScore().rms, rms_max);
+    return 1;
+  }
+  printf("simcombo: rms %u", _field.getScore().rms);
+#endif
+
+  // Manual, with taps
+  arduino_pins[MODE_PIN] = LOW;
+  script = SCRIPT_TAP;
+  _end = clock_now + COMBO_MANUAL;
+  while (clock_now < _end){
+    _interface.update();
+  }
+
+  // Every step declined
+  script = SCRIPT_DECLINE;
+  _start = clock_now;
+  clock_limit = clock_now + COMBO_CALIBRATE;
+  _interface.calibrate();
+  clock_limit = 0;
+
+  printf(", calibrate %lu ms\n", clock_now - _start);
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*
+  simsweep - sweeps the implement settings over simulated field passes
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Runs the default field pass (SIM_PASS) once for every combination of the
+ ranges, on all cores, and writes every result as CSV, best (lowest cost)
+ first. Cost is the RMS tracking error in 0.1 mm plus SIM_SWEEP_EFFORT
+ times the mean valve duty in %.
+
+ usage: simsweep [-j threads] [-o file] [-r name=min:max:step]...
+
+   -j  worker threads (default all cores)
+   -o  CSV file (default stdout)
+   -r  range of kp, pwm_auto, pwm_man, error, max_correction or shares;
+       a step of 0 keeps the parameter at min
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <thread>
+
+#include "SimSweep.h"
+
+// Default ranges, in the order of SIM_KP .. SIM_SHARES
+static SimRange ranges[SIM_PARAMETERS] = {
+  {50, 200, 50},    // kp
+  {100, 250, 50},   // pwm_auto
+  {200, 200, 0},    // pwm_man
+  {1, 3, 1},        // error
+  {20, 40, 10},     // max_correction
+  {3, 7, 2}         // shares
+};
+
+// ---------------------------------------
+// Method for parsing -r name=min:max:step
+// ---------------------------------------
+static bool parseRange(const char * _arg){
+  const char * _value = strchr(_arg, '=');
+  SimRange _range;
+
+  if (!_value ||
+      sscanf(_value + 1, "%d:%d:%d", &_range.min, &_range.max,
+             &_range.step) != 3 ||
+      _range.max < _range.min || _range.step < 0){
+    return false;
+  }
+
+  for (byte i = 0; i < SIM_PARAMETERS; i++){
+    if (strlen(sim_parameter_names[i]) == size_t(_value - _arg) &&
+        !strncmp(sim_parameter_names[i], _arg, _value - _arg)){
+      ranges[i] = _range;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void usage(){
+  fprintf(stderr, "usage: simsweep [-j threads] [-o file] "
+                  "[-r name=min:max:step]...\n");
+}
+
+int main(int argc, char ** argv){
+  unsigned int _threads = std::thread::hardware_concurrency();
+  const char * _output = 0;
+  struct timespec _start;
+  struct timespec _end;
+  FILE * _file = stdout;
+  int _option;
+
+  while ((_option = getopt(argc, argv, "j:o:r:")) != -1){
+    switch (_option){
+    case 'j': _threads = atoi(optarg); break;
+    case 'o': _output = optarg; break;
+    case 'r':
+      if (!parseRange(optarg)){
+        fprintf(stderr, "simsweep: bad range %s\n", optarg);
+        return 2;
+      }
+      break;
+    default:
+      usage();
+      return 2;
+    }
+  }
+  if (optind != argc){
+    usage();
+    return 2;
+  }
+
+  if (_output){
+    _file = fopen(_output, "w");
+    if (!_file){
+      perror(_output);
+      return 1;
+    }
+  }
+
+  SimSweep _sweep(SIM_PASS, SIM_PASS_SEGMENTS, ranges);
+
+  clock_gettime(CLOCK_MONOTONIC, &_start);
+  _sweep.sweep(_threads);
+  clock_gettime(CLOCK_MONOTONIC, &_end);
+
+  _sweep.report(_file);
+  if (_file != stdout){
+    fclose(_file);
+  }
+
+  fprintf(stderr, "simsweep: %lu runs on %u threads in %.1f s\n",
+          _sweep.getRuns(), _threads ? _threads : 1,
+          (_end.tv_sec - _start.tv_sec) +
+          (_end.tv_nsec - _start.tv_nsec) / 1e9);
+  return 0;
+}
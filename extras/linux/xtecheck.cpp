@@ -0,0 +1,458 @@
+/*
+  xtecheck - fixed-point XTE path against a double precision model
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Replays XTE fixes through InterfacePlough::estimateXte(), predictXte()
+ and shapeXte() and through the same filter and shaper in double
+ precision, and reports the largest difference of the estimate, the rate,
+ the predicted XTE and the shaped setpoint, sampled every -p ms between
+ fixes. Both shapers get the fixed-point prediction as their target, so
+ the shaped setpoint only differs by the shaper. perMille() is checked
+ over its whole input range.
+
+ The fixes come from the XTE fix records of a ploughd ring file (-r), or
+ else from a generated pass: 10 Hz and 20 Hz fixes with jitter, sway,
+ jumps beyond KF_RESIDUAL_MAX, rates beyond KF_RATE_MAX and gaps beyond
+ KF_RESET.
+
+ Ranges of the fixed-point formats on the AVR are checked at compile time
+ by the static_asserts in InterfacePlough.cpp.
+
+ usage: xtecheck [-r ring] [-n fixes] [-p ms] [-e cm] [-v cm/s] [-t cm]
+                 [-s cm]
+
+   -r  ring file written by ploughd -r
+   -n  number of generated fixes (default 200000)
+   -p  prediction sample period (default 10 ms)
+   -e  fail when the estimate differs more than this (default 1 cm)
+   -v  fail when the rate differs more than this (default 4 cm/s)
+   -t  fail when the prediction differs more than this (default 2 cm)
+   -s  fail when the shaped setpoint differs more than this (default 3 cm)
+
+ The fix interval is kept in whole ms, which alone makes the rate step of
+ a fix up to 2% off at 20 Hz, up to 3 cm/s on a residual of
+ KF_RESIDUAL_MAX; with the prediction horizon and rounding to cm the
+ prediction stays below 2 cm. The shaper keeps its rate in 1/16 cm/s and
+ its error in 1/16 cm, so when the stopping distance is within rounding of
+ the error it brakes a tick earlier or later than the model; the ramps
+ then run up to about 2.5 cm apart until the next settle.
+ perMille() may be off by its gain error, 1049 / 2^20 against 1 / 1000,
+ plus rounding.
+*/
+
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <vector>
+
+#include "InterfacePlough.h"
+#include "PloughLog.h"
+
+#if !defined(XTE_ESTIMATOR) || !defined(PREDICT) || !defined(SHAPE)
+#error "build xtecheck with -DXTE_ESTIMATOR -DPREDICT -DSHAPE"
+#endif
+
+// One XTE fix
+struct Fix {
+  unsigned long time;     // ms
+  int xte;                // cm
+};
+
+static unsigned long clock_now;
+
+static unsigned long readClock(){
+  return clock_now;
+}
+
+// ----------------------------------------------------
+// The estimator of InterfacePlough in double precision
+// ----------------------------------------------------
+struct XteModel {
+  double estimate;        // cm
+  double rate;            // cm/s
+  double step;            // cm
+  double interval;        // ms
+  unsigned long fix;
+
+  XteModel(){
+    estimate = 0;
+    rate = 0;
+    step = 0;
+    interval = 100;
+    fix = 0;
+  };
+
+  void update(const Fix & _fix){
+    unsigned long _interval = _fix.time - fix;
+    double _residual;
+    double _before;
+
+    fix = _fix.time;
+
+    if (_interval > KF_RESET){
+      estimate = _fix.xte;
+      rate = 0;
+      step = 0;
+      return;
+    }
+
+    interval = (interval + fmax(_interval, KF_INTERVAL_MIN)) / 2;
+
+    estimate += rate * _interval / 1000;
+    _residual = fmin(fmax(_fix.xte - estimate, -KF_RESIDUAL_MAX),
+                     KF_RESIDUAL_MAX);
+    _before = estimate;
+
+    estimate += _residual * KF_ALPHA / 256;
+    rate += _residual * KF_BETA / 256 * 1000 / interval;
+    rate = fmin(fmax(rate, -KF_RATE_MAX), KF_RATE_MAX);
+
+    step = _before - estimate;
+  };
+
+  double predict(unsigned long _now){
+    double _age = _now - fix;
+    double _horizon = _age;
+    double _step = 0;
+
+    if (_age < interval){
+      _step = step * (interval - _age) / interval;
+    }
+    if (PloughFeatures::predict){
+      _horizon += PREDICT_LATENCY;
+    }
+    if (_horizon > PREDICT_MAX){
+      _horizon = PREDICT_MAX;
+    }
+    return estimate + rate * _horizon / 1000 + _step;
+  };
+};
+
+// ----------------------------------------------------
+// The shaper of InterfacePlough in double precision
+// ----------------------------------------------------
+struct ShapeModel {
+  double position;        // cm
+  double rate;            // cm/s
+  unsigned long time;
+
+  ShapeModel(){
+    position = 0;
+    rate = 0;
+    time = 0;
+  };
+
+  // In AUTO, as the interface runs it in xtecheck
+  double update(int _target, unsigned long _now){
+    double _dt = (long)(_now - time);
+    double _error, _dv, _desired;
+
+    time = _now;
+
+    if (_dt >= 500){
+      position = _target;
+      rate = 0;
+      return position;
+    }
+
+    _error = _target - position;
+    _dv = SHAPE_ACCEL * _dt / 1000;
+
+    // Saturated as the Q4 error, 32767 / 16 cm
+    _error = fmin(fmax(_error, -32767 / 16.0), 32767 / 16.0);
+
+    if (_error == 0 ||
+        ((_error >= 0) == (rate >= 0) &&
+         rate * rate >= 2.0 * SHAPE_ACCEL * fabs(_error))){
+      _desired = 0;
+    }
+    else if (_error > 0){
+      _desired = SHAPE_RATE;
+    }
+    else {
+      _desired = -SHAPE_RATE;
+    }
+
+    rate = fmin(fmax(_desired, rate - _dv), rate + _dv);
+    position += rate * _dt / 1000;
+
+    if (fabs(_error) < 1 && fabs(rate) <= _dv){
+      position = _target;
+      rate = 0;
+    }
+    return position;
+  };
+};
+
+// Largest differences
+struct XteError {
+  double estimate;
+  double rate;
+  double predict;
+  double shape;
+  unsigned long predict_time;
+  unsigned long shape_time;
+  unsigned long samples;
+};
+
+// --------------------------------------
+// Access to the private fixed-point path
+// --------------------------------------
+class XteCheck {
+private:
+  LiquidCrystal_I2C lcd;
+  ImplementPlough implement;
+  VehicleGps gps;
+  VehicleTractor tractor;
+  InterfacePlough<> interface;
+public:
+  XteCheck() : implement(0), gps(0), tractor(0),
+               interface(&lcd, &implement, &tractor, &gps){
+    // Prediction is only applied in AUTO
+    interface.mode = 0;
+  };
+
+  inline void estimate(const Fix & _fix){
+    PloughSnapshot _snapshot;
+
+    memset(&_snapshot, 0, sizeof(_snapshot));
+    _snapshot.time = _fix.time;
+    _snapshot.xte = _fix.xte;
+    _snapshot.xte_fix = _fix.time;
+    interface.estimateXte(_snapshot);
+  };
+  inline int predict(){
+    return interface.predictXte();
+  };
+  inline int shape(int _target){
+    return interface.shapeXte(_target);
+  };
+  inline double getEstimate(){
+    return interface.xte_estimate / 16.0;
+  };
+  inline double getRate(){
+    return interface.xte_rate / 16.0;
+  };
+  static inline long perMille(long _x){
+    return InterfacePlough<>::perMille(_x);
+  };
+};
+
+// ---------------------------------------------------------
+// Method for reading the XTE fixes of a ring file, in order
+// ---------------------------------------------------------
+static bool readRing(const char * _path, std::vector<Fix> & _fixes){
+  const PloughLogHeader * _header;
+  const PloughLogRecord * _records;
+  const PloughLogRecord * _record;
+  struct stat _stat;
+  uint64_t _count;
+  uint64_t _first;
+  Fix _fix;
+  int _fd;
+
+  _fd = open(_path, O_RDONLY);
+  if (_fd < 0 || fstat(_fd, &_stat) < 0){
+    perror(_path);
+    return false;
+  }
+  _header = (const PloughLogHeader *)mmap(0, _stat.st_size, PROT_READ,
+                                          MAP_SHARED, _fd, 0);
+  close(_fd);
+  if (_header == MAP_FAILED ||
+      (uint64_t)_stat.st_size < sizeof(PloughLogHeader) ||
+      _header->magic != PLOUGH_LOG_MAGIC ||
+      _header->version != PLOUGH_LOG_VERSION ||
+      _header->record_size != sizeof(PloughLogRecord) ||
+      _header->capacity == 0 ||
+      sizeof(PloughLogHeader) + _header->capacity * sizeof(PloughLogRecord) >
+      (uint64_t)_stat.st_size){
+    fprintf(stderr, "xtecheck: %s is not a version %d ring file\n",
+            _path, PLOUGH_LOG_VERSION);
+    return false;
+  }
+  _records = (const PloughLogRecord *)(_header + 1);
+
+  _count = __atomic_load_n(&_header->count, __ATOMIC_ACQUIRE);
+  _first = _count > _header->capacity ? _count - _header->capacity : 0;
+
+  for (uint64_t i = _first; i < _count; i++){
+    _record = &_records[i % _header->capacity];
+    if (_record->flags & PLOUGH_LOG_XTE_FIX){
+      _fix.time = _record->time;
+      _fix.xte = _record->xte;
+      _fixes.push_back(_fix);
+    }
+  }
+  return true;
+}
+
+// --------------------------------------
+// Method for generating a synthetic pass
+// --------------------------------------
+static void generate(unsigned long _count, std::vector<Fix> & _fixes){
+  unsigned long _time = 1000;
+  double _xte = 0;
+  double _rate = 0;
+  int _epoch = 100;
+  Fix _fix;
+
+  srand(1);
+  for (unsigned long i = 0; i < _count; i++){
+    // Every few seconds another GPS rate, course or disturbance
+    if (i % 50 == 0){
+      _epoch = rand() % 2 ? 100 : 50;
+      _rate = (rand() % 3001 - 1500) / 10.0;
+      if (rand() % 10 == 0){
+        _xte += rand() % 4001 - 2000;
+      }
+      if (rand() % 20 == 0){
+        _time += KF_RESET + rand() % 2000;
+      }
+    }
+
+    _time += _epoch + rand() % 21 - 10;
+    _xte += _rate * _epoch / 1000;
+    _xte = fmin(fmax(_xte, -10000), 10000);
+
+    _fix.time = _time;
+    _fix.xte = int(lround(_xte + 20 * sin(_time / 700.0))) + rand() % 5 - 2;
+    _fixes.push_back(_fix);
+  }
+}
+
+int main(int argc, char ** argv){
+  const char * _ring = 0;
+  unsigned long _count = 200000;
+  unsigned long _period = 10;
+  double _limit_estimate = 1;
+  double _limit_rate = 4;
+  double _tolerance = 2;
+  double _limit_shape = 3;
+  std::vector<Fix> _fixes;
+  XteError _error = {0, 0, 0, 0, 0, 0, 0};
+  double _per_mille = 0;
+  bool _per_mille_failed = false;
+  double _d;
+  int _target;
+  int _option;
+
+  while ((_option = getopt(argc, argv, "r:n:p:e:v:t:s:")) != -1){
+    switch (_option){
+    case 'r': _ring = optarg; break;
+    case 'n': _count = strtoul(optarg, 0, 10); break;
+    case 'p': _period = strtoul(optarg, 0, 10); break;
+    case 'e': _limit_estimate = atof(optarg); break;
+    case 'v': _limit_rate = atof(optarg); break;
+    case 't': _tolerance = atof(optarg); break;
+    case 's': _limit_shape = atof(optarg); break;
+    default:
+      fprintf(stderr, "usage: xtecheck [-r ring] [-n fixes] [-p ms] "
+                      "[-e cm] [-v cm/s] [-t cm] [-s cm]\n");
+      return 2;
+    }
+  }
+  if (_period < 1){
+    _period = 1;
+  }
+
+  // perMille() over its whole input range
+  for (long x = -PER_MILLE_MAX; x <= PER_MILLE_MAX; x++){
+    _d = fabs(XteCheck::perMille(x) - x / 1000.0);
+    if (_d > _per_mille){
+      _per_mille = _d;
+    }
+    if (_d > 0.5 + labs(x) * (1049.0 / 1048576 - 0.001) + 1e-9){
+      _per_mille_failed = true;
+    }
+  }
+
+  if (_ring){
+    if (!readRing(_ring, _fixes)){
+      return 1;
+    }
+  }
+  else {
+    generate(_count, _fixes);
+  }
+
+  arduino_clock = readClock;
+  clock_now = 0;
+
+  XteCheck _check;
+  XteModel _model;
+  ShapeModel _shape;
+
+  for (unsigned long i = 0; i < _fixes.size(); i++){
+    // Fixes with the same time are one fix
+    if (i && _fixes[i].time == _fixes[i - 1].time){
+      continue;
+    }
+
+    clock_now = _fixes[i].time;
+    _check.estimate(_fixes[i]);
+    _model.update(_fixes[i]);
+
+    _d = fabs(_check.getEstimate() - _model.estimate);
+    _error.estimate = fmax(_error.estimate, _d);
+    _d = fabs(_check.getRate() - _model.rate);
+    _error.rate = fmax(_error.rate, _d);
+
+    // Predictions until the next fix
+    do {
+      _target = _check.predict();
+      _d = fabs(_target - _model.predict(clock_now));
+      if (_d > _error.predict){
+        _error.predict = _d;
+        _error.predict_time = clock_now;
+      }
+
+      // Shaped setpoint, on the same target
+      _d = fabs(_check.shape(_target) - _shape.update(_target, clock_now));
+      if (_d > _error.shape){
+        _error.shape = _d;
+        _error.shape_time = clock_now;
+      }
+      _error.samples++;
+      clock_now += _period;
+    } while (i + 1 < _fixes.size() &&
+             (long)(_fixes[i + 1].time - clock_now) > 0);
+  }
+
+  printf("perMille  max error %.4f over |x| <= %ld%s\n",
+         _per_mille, PER_MILLE_MAX, _per_mille_failed ? ", over bound" : "");
+  printf("fixes     %lu, %lu predictions\n",
+         (unsigned long)_fixes.size(), _error.samples);
+  printf("estimate  max error %.3f cm (limit %.2f)\n",
+         _error.estimate, _limit_estimate);
+  printf("rate      max error %.3f cm/s (limit %.2f)\n",
+         _error.rate, _limit_rate);
+  printf("predict   max error %.3f cm at %lu ms (rounded to cm, limit %.2f)\n",
+         _error.predict, _error.predict_time, _tolerance);
+  printf("shape     max error %.3f cm at %lu ms (rounded to cm, limit %.2f)\n",
+         _error.shape, _error.shape_time, _limit_shape);
+
+  return _error.estimate > _limit_estimate ||
+         _error.rate > _limit_rate ||
+         _error.predict > _tolerance ||
+         _error.shape > _limit_shape ||
+         _per_mille_failed ? 1 : 0;
+}
@@ -0,0 +1,2 @@
+// The library includes "Language.h", the file is language.h
+#include "../../language.h"
@@ -0,0 +1,57 @@
+/*
+  LiquidCrystal_I2C.h - 20x4 screen buffer without I2C, for simavr
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ simavr has no display on the bus, so writing the screen is left out of
+ the cycle counts: write_screen reports only the call.
+ */
+
+#ifndef LiquidCrystal_I2C_h
+#define LiquidCrystal_I2C_h
+
+#include "Arduino.h"
+
+#define LCD_COLUMNS       20
+#define LCD_ROWS          4
+
+class LiquidCrystal_I2C {
+private:
+  //-------------
+  // data members
+  //-------------
+  char buffer[LCD_ROWS][LCD_COLUMNS];
+public:
+  // Same buffer interface as the I2C display
+  inline void write_buffer(const char * _text, int _row){
+    if (_row < 0 || _row >= LCD_ROWS){
+      return;
+    }
+    for (byte i = 0; i < LCD_COLUMNS && _text[i]; i++){
+      buffer[_row][i] = _text[i];
+    }
+  };
+  inline void write_buffer(char _c, int _row, int _column){
+    if (_row < 0 || _row >= LCD_ROWS || _column < 0 || _column >= LCD_COLUMNS){
+      return;
+    }
+    buffer[_row][_column] = _c;
+  };
+  inline void write_screen(int _count){
+  };
+};
+
+#endif
@@ -0,0 +1,201 @@
+/*
+  profile - cycle counts of InterfacePlough in simavr
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Sketch for the simavr profile (see Makefile). Runs the simulated field
+ pass for PROFILE_RUN ms in AUTO and PROFILE_RUN ms in MANUAL with left
+ and right taps, then enters calibrate with both buttons and declines
+ every step. After one more report of the library (PRF,part,calls,mean
+ cycles,max cycles, every PROFILE_REPORT ms) the CPU is stopped.
+
+ The cycles are counted by Timer1 at F_CPU. The buttons are played by
+ the Timer2 interrupt at 1 kHz on the button pins, set as outputs; its
+ cycles, about 1% of the CPU, are included in the counts.
+*/
+
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#include "InterfacePlough.h"
+
+#define PROFILE_RUN       20000 // ms per phase
+#define TAP_PERIOD        700   // ms between taps
+#define TAP_LENGTH        100   // ms a tap is held
+#define CHORD_LENGTH      1500  // ms both are held to enter calibrate
+
+// Buttons played by the interrupt
+#define SCRIPT_NONE       0
+#define SCRIPT_TAP        1     // left and right in turn
+#define SCRIPT_CHORD      2     // both, then left to decline every step
+
+// Phases of the run
+#define PHASE_AUTO        0
+#define PHASE_MANUAL      1
+#define PHASE_CALIBRATE   2
+#define PHASE_REPORT      3
+
+static LiquidCrystal_I2C lcd;
+static SimField field(SIM_PASS, SIM_PASS_SEGMENTS);
+static ImplementPlough implement(&field);
+static VehicleGps gps(&field);
+static VehicleTractor tractor(&field);
+static InterfacePlough<> interface(&lcd, &implement, &tractor, &gps);
+
+static volatile unsigned int cycles_high;
+static volatile byte script;
+static volatile unsigned int chord_time;
+static volatile unsigned int tap_time;
+static volatile boolean tap_right;
+
+static byte phase;
+static unsigned long phase_start;
+
+// ------------------------------------
+// Method for counting Timer1 overflows
+// ------------------------------------
+ISR(TIMER1_OVF_vect){
+  cycles_high++;
+}
+
+// ----------------------------------------
+// Method for playing the buttons, every ms
+// ----------------------------------------
+ISR(TIMER2_COMPA_vect){
+  boolean _left = false;
+  boolean _right = false;
+
+  if (script == SCRIPT_CHORD && chord_time < CHORD_LENGTH){
+    chord_time++;
+    _left = true;
+    _right = true;
+  }
+  else if (script != SCRIPT_NONE){
+    // A tap at the start of every period, in turn only with SCRIPT_TAP
+    if (++tap_time >= TAP_PERIOD){
+      tap_time = 0;
+      tap_right = script == SCRIPT_TAP && !tap_right;
+    }
+    if (tap_time < TAP_LENGTH){
+      _left = !tap_right;
+      _right = tap_right;
+    }
+  }
+
+  digitalWrite(LEFT_BUTTON, _left ? HIGH : LOW);
+  digitalWrite(RIGHT_BUTTON, _right ? HIGH : LOW);
+}
+
+// --------------------------------------------
+// Method for reading CPU cycles, PROFILE_CLOCK
+// --------------------------------------------
+unsigned long profileCycles(){
+  uint8_t _sreg = SREG;
+  unsigned int _low;
+  unsigned int _high;
+
+  cli();
+  _low = TCNT1;
+  _high = cycles_high;
+
+  // An overflow that is not counted yet
+  if ((TIFR1 & _BV(TOV1)) && _low < 0x8000){
+    _high++;
+  }
+  SREG = _sreg;
+
+  return ((unsigned long)_high << 16) | _low;
+}
+
+// -----------------------------------
+// Method for starting a button script
+// -----------------------------------
+static void play(byte _script){
+  uint8_t _sreg = SREG;
+
+  // The first tap after a released period
+  cli();
+  script = _script;
+  chord_time = 0;
+  tap_time = TAP_LENGTH;
+  tap_right = false;
+  SREG = _sreg;
+}
+
+void setup(){
+  Serial.begin(115200);
+
+  // Timer1 counts cycles
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);
+  TCNT1 = 0;
+  TIMSK1 = _BV(TOIE1);
+
+  // Timer2 at 1 kHz (CTC, F_CPU / 64 / 250) plays the buttons
+  TCCR2A = _BV(WGM21);
+  TCCR2B = _BV(CS22);
+  OCR2A = F_CPU / 64 / 1000 - 1;
+  TIMSK2 = _BV(OCIE2A);
+
+  // Driven pins read back as driven; switch in automatic
+  pinMode(LEFT_BUTTON, OUTPUT);
+  pinMode(RIGHT_BUTTON, OUTPUT);
+  pinMode(MODE_PIN, OUTPUT);
+  digitalWrite(MODE_PIN, HIGH);
+
+  play(SCRIPT_NONE);
+  phase = PHASE_AUTO;
+  phase_start = (millis)();
+}
+
+void loop(){
+  interface.update();
+
+  switch (phase){
+  case PHASE_AUTO:
+    if ((millis)() - phase_start >= PROFILE_RUN){
+      digitalWrite(MODE_PIN, LOW);
+      play(SCRIPT_TAP);
+      phase = PHASE_MANUAL;
+      phase_start = (millis)();
+    }
+    break;
+  case PHASE_MANUAL:
+    if ((millis)() - phase_start >= PROFILE_RUN){
+      play(SCRIPT_CHORD);
+      phase = PHASE_CALIBRATE;
+    }
+    break;
+  case PHASE_CALIBRATE:
+    // Mode stays 3 until the tick after calibrate() returned
+    if (interface.getMode() == 3){
+      play(SCRIPT_NONE);
+      phase = PHASE_REPORT;
+      phase_start = (millis)();
+    }
+    break;
+  case PHASE_REPORT:
+    if ((millis)() - phase_start > PROFILE_REPORT + 100){
+      Serial.flush();
+
+      // Interrupts off and asleep, simavr stops
+      cli();
+      sleep_enable();
+      sleep_cpu();
+    }
+    break;
+  }
+}
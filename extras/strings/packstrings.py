@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+#
+#  packstrings.py - packs the screen texts of language.h into flash
+# Copyright (C) 2011-2015 J.A. Woltjer.
+# All rights reserved.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Reads every L_* text of every language in language.h and writes
+# LanguagePacked.h and LanguagePacked.cpp, used when PACKED_STRINGS is
+# defined in ConfigInterfacePlough.h. Run it again after changing
+# language.h; it fails when a text is not LANG_COLUMNS characters.
+#
+# Every text is a row of the screen, coded per byte as:
+#
+#   0x01 - 0x14  run of 1 to 20 spaces
+#   0x15         escape, the next byte is written as is
+#   0x20 - 0x7e  character
+#   0x80 - 0xff  entry of the dictionary of that language
+#
+# The splash texts (PLAIN) stay plain strings: sketches pass them to
+# lcd->write_buffer() themselves, which cannot read flash.
+#
+# The decoder stops after LANG_COLUMNS characters, so texts need no
+# terminator. Dictionary entries are plain characters, picked greedily by
+# the bytes they save over all texts of the language. Equal texts are
+# stored once.
+#
+# usage: packstrings.py [-l language.h] [-o directory]
+
+import argparse
+import os
+import re
+import sys
+
+COLUMNS = 20
+RUN_MAX = 20
+ESCAPE = 0x15
+DICT = 0x80
+DICT_MAX = 128
+ENTRY_MIN = 3
+ENTRY_MAX = 12
+
+# Texts written by the sketches, not by the library
+PLAIN = ('L_MEIJWORKS', 'L_DEVICE', 'L_COPYRIGHT', 'L_AUTHOR')
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+LIBRARY = os.path.normpath(os.path.join(HERE, '..', '..'))
+
+LICENSE = '''/*
+  %s - screen texts of language.h, packed
+ Copyright (C) 2011-2015 J.A. Woltjer.
+ All rights reserved.
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU Lesser General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ GNU Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+ Generated by extras/strings/packstrings.py from language.h, do not edit.
+ */
+'''
+
+
+# -----------------------------------------------
+# Reads the texts of each language, in file order
+# -----------------------------------------------
+def parse(path):
+    languages = []
+    texts = None
+
+    with open(path, encoding='latin-1') as f:
+        for number, line in enumerate(f, 1):
+            m = re.match(r'#(?:ifdef|elif\s+defined)\s+(\w+)', line)
+            if m:
+                texts = []
+                languages.append((m.group(1), texts))
+                continue
+
+            m = re.match(r'#define\s+(L_\w+)\s+"(.*)"', line)
+            if m and texts is not None:
+                if len(m.group(2)) != COLUMNS:
+                    sys.exit('%s:%d: %s is %d characters, not %d' %
+                             (path, number, m.group(1), len(m.group(2)),
+                              COLUMNS))
+                if m.group(1) not in PLAIN:
+                    texts.append((m.group(1),
+                                  m.group(2).encode('latin-1')))
+
+    return languages
+
+
+# ----------------------------------------------------------------
+# Splits a text in symbols: a character (int) or a space run (str)
+# ----------------------------------------------------------------
+def symbols(text):
+    out = []
+    i = 0
+
+    while i < len(text):
+        j = i
+        while j < len(text) and text[j] == 0x20:
+            j += 1
+        if j - i >= 2:
+            out.append(' ' * (j - i))
+            i = j
+        else:
+            out.append(text[i])
+            i += 1
+
+    return out
+
+
+# -------------------------------------------------------------
+# Picks dictionary entries; returns the entries and coded texts
+# -------------------------------------------------------------
+def build(texts):
+    coded = [symbols(text) for text in set(t for _, t in texts)]
+    entries = []
+
+    while len(entries) < DICT_MAX:
+        counts = {}
+
+        # Candidates are runs of printable characters
+        for s in coded:
+            for i in range(len(s)):
+                for n in range(ENTRY_MIN, ENTRY_MAX + 1):
+                    part = s[i:i + n]
+                    if len(part) < n or not all(
+                            isinstance(c, int) and 0x20 <= c <= 0x7e
+                            for c in part):
+                        break
+                    key = bytes(part)
+                    counts[key] = counts.get(key, 0) + 1
+
+        # Saved: n - 1 per use, minus the entry and its index
+        best = None
+        best_gain = 0
+        for key, count in counts.items():
+            gain = count * (len(key) - 1) - len(key) - 2
+            if gain > best_gain or (gain == best_gain and best and
+                                    key < best):
+                best, best_gain = key, gain
+
+        if not best:
+            break
+
+        code = ('entry', len(entries))
+        entries.append(best)
+        for s in coded:
+            i = 0
+            while i <= len(s) - len(best):
+                if all(isinstance(c, int) for c in s[i:i + len(best)]) and \
+                   bytes(s[i:i + len(best)]) == best:
+                    s[i:i + len(best)] = [code]
+                i += 1
+
+    return entries, coded
+
+
+# ------------------------------------------
+# Codes the symbols of one text to its bytes
+# ------------------------------------------
+def encode(text, entries):
+    out = bytearray()
+
+    for symbol in symbols(text):
+        if isinstance(symbol, str):
+            out.append(len(symbol))
+        elif 0x20 <= symbol <= 0x7e:
+            out.append(symbol)
+        else:
+            out += bytes([ESCAPE, symbol])
+
+    # Replace entries in the order they were picked, as build() did
+    for n, entry in enumerate(entries):
+        out = replace(out, entry, DICT + n)
+
+    return bytes(out)
+
+
+# ------------------------------------------------------------------
+# Replaces an entry in coded bytes, never inside an escape or a code
+# ------------------------------------------------------------------
+def replace(coded, entry, code):
+    out = bytearray()
+    i = 0
+
+    while i < len(coded):
+        if coded[i] == ESCAPE:
+            out += coded[i:i + 2]
+            i += 2
+        elif coded[i:i + len(entry)] == entry:
+            out.append(code)
+            i += len(entry)
+        else:
+            out.append(coded[i])
+            i += 1
+
+    return out
+
+
+# --------------------------------
+# Decodes, to check the coded text
+# --------------------------------
+def decode(coded, entries):
+    out = bytearray()
+    i = 0
+
+    while len(out) < COLUMNS:
+        c = coded[i]
+        i += 1
+        if c >= DICT:
+            out += entries[c - DICT]
+        elif c == ESCAPE:
+            out.append(coded[i])
+            i += 1
+        elif c <= RUN_MAX:
+            out += b' ' * c
+        else:
+            out.append(c)
+
+    return bytes(out)
+
+
+# -------------------------------
+# C literal of bytes, 12 per line
+# -------------------------------
+def array(data):
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append('  ' + ' '.join('0x%02x,' % b for b in data[i:i + 12]))
+    return '\n'.join(lines)
+
+
+# ---------------------------
+# Printable comment of a text
+# ---------------------------
+def comment(text):
+    return text.decode('latin-1').encode('ascii', 'replace').decode()
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('-l', default=os.path.join(LIBRARY, 'language.h'))
+    parser.add_argument('-o', default=LIBRARY)
+    args = parser.parse_args()
+
+    header = [LICENSE % 'LanguagePacked.h',
+              '#ifndef LanguagePacked_h',
+              '#define LanguagePacked_h',
+              '',
+              '#include <stdint.h>',
+              '',
+              '#define LANG_COLUMNS      %d' % COLUMNS,
+              '#define LANG_RUN_MAX      0x%02x' % RUN_MAX,
+              '#define LANG_ESCAPE       0x%02x' % ESCAPE,
+              '#define LANG_DICT         0x%02x' % DICT,
+              '',
+              'extern const uint8_t lang_packed[];',
+              'extern const uint8_t lang_dict[];',
+              'extern const uint16_t lang_dict_index[];',
+              '']
+    source = [LICENSE % 'LanguagePacked.cpp',
+              '#include "Arduino.h"',
+              '',
+              '#include "ConfigInterfacePlough.h"',
+              '#include "Language.h"',
+              '',
+              '#ifdef PACKED_STRINGS',
+              '#include "LanguagePacked.h"',
+              '']
+
+    for n, (language, texts) in enumerate(parse(args.l)):
+        entries, _ = build(texts)
+
+        packed = bytearray()
+        offsets = {}
+        for name, text in texts:
+            coded = encode(text, entries)
+            if decode(coded, entries) != text:
+                sys.exit('%s: %s does not decode' % (language, name))
+            if coded not in offsets:
+                offsets[coded] = len(packed)
+                packed += coded
+
+        index = [0]
+        for entry in entries:
+            index.append(index[-1] + len(entry))
+
+        plain = len(set(t for _, t in texts)) * (COLUMNS + 1)
+        total = len(packed) + index[-1] + 2 * len(index)
+        print('%-12s %3d texts %5d bytes plain %5d packed (%d entries)' %
+              (language, len(texts), plain, total, len(entries)))
+
+        directive = '#ifdef' if n == 0 else '#elif defined'
+        banner = '// ' + '-' * len('Taal ' + language)
+
+        header += [banner, '// Taal ' + language, banner,
+                   '%s %s' % (directive, language), '']
+        for name, text in texts:
+            header += ['#undef %s' % name,
+                       '#define %-18s ((const char *)lang_packed + %d)' %
+                       (name, offsets[encode(text, entries)])]
+        header.append('')
+
+        source += [banner, '// Taal ' + language, banner,
+                   '%s %s' % (directive, language), '',
+                   'const uint8_t lang_packed[] PROGMEM = {']
+        for name, text in texts:
+            coded = encode(text, entries)
+            if offsets.pop(coded, None) is not None:
+                source.append('  // %s "%s"' % (name, comment(text)))
+                source.append(array(coded))
+        source += ['};', '',
+                   'const uint8_t lang_dict[] PROGMEM = {']
+        for entry in entries:
+            source.append('  // "%s"' % entry.decode())
+            source.append(array(entry))
+        source += ['  0', '};', '',
+                   'const uint16_t lang_dict_index[] PROGMEM = {',
+                   '\n'.join('  ' + ' '.join('%d,' % v for v in index[i:i + 12])
+                             for i in range(0, len(index), 12)),
+                   '};', '']
+
+    header += ['#endif', '', '#endif', '']
+    source += ['#endif', '', '#endif', '']
+
+    with open(os.path.join(args.o, 'LanguagePacked.h'), 'w') as f:
+        f.write('\n'.join(header))
+    with open(os.path.join(args.o, 'LanguagePacked.cpp'), 'w') as f:
+        f.write('\n'.join(source))
+
+
+if __name__ == '__main__':
+    main()
@@ -67,6 +67,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define L_CAL_SHARES    "Adjust am. of shares"
 #define L_CAL_SHARES_AD "Amount of shares:   "
 
+#define L_CAL_TUNE      "Autotune controller "
+#define L_CAL_TUNE_RUN  "Tuning, keep still  "
+#define L_CAL_TUNE_FAIL "failed or aborted   "
+#define L_CAL_TUNE_AD   "K .   P    E  M     "
+
+#define L_LAT           "Latency fix > valve "
+#define L_LAT_AD        "min    mean   max ms"
+#define L_LAT_HIST      "   ms bins:         "
+
 #define L_CAL_KP        "PID adjust KP       "
 #define L_CAL_KP_AD     "KP:                 "
 
@@ -90,6 +99,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define L_CAL_SPEED     "Speed calibration   "
 #define L_CAL_SPEED_AD  "Accelerate to 10kph "
+#define L_CAL_WHEEL     "Drive exactly 100 m "
+#define L_CAL_WHEEL_AD  "Pulses:             "
 
 #define L_CAL_GPS       "GPS autodetect      "
 #define L_CAL_GPS_DONE  "passed              "
@@ -140,6 +151,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define L_CAL_SHARES    "Wijzig aant. scharen"
 #define L_CAL_SHARES_AD "Aantal scharen:     "
 
+#define L_CAL_TUNE      "Regelaar autotune   "
+#define L_CAL_TUNE_RUN  "Afregelen, stilstaan"
+#define L_CAL_TUNE_FAIL "mislukt/afgebroken  "
+#define L_CAL_TUNE_AD   "K .   P    E  M     "
+
+#define L_LAT           "Vertraging fix>klep "
+#define L_LAT_AD        "min    gem.   max ms"
+#define L_LAT_HIST      "   ms klassen:      "
+
 #define L_CAL_KP        "PID wijzig KP       "
 #define L_CAL_KP_AD     "KP:                 "
 
@@ -166,6 +186,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #define L_CAL_SPEED     "Snelheids calibratie"
 #define L_CAL_SPEED_AD  "Accelereer tot 10kmh"
+#define L_CAL_WHEEL     "Rij precies 100 m   "
+#define L_CAL_WHEEL_AD  "Pulsen:             "
 
 #define L_CAL_GPS       "GPS autodetect      "
 #define L_CAL_GPS_DONE  "geslaagd            "